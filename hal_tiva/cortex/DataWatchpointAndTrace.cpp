@@ -6,23 +6,27 @@ namespace hal
     {
         CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
         DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
     }
 
     DataWatchPointAndTrace::~DataWatchPointAndTrace()
     {
+        DWT->CTRL &= ~DWT_CTRL_CYCCNTENA_Msk;
         CoreDebug->DEMCR &= ~CoreDebug_DEMCR_TRCENA_Msk;
     }
 
     void DataWatchPointAndTrace::Start() const
     {
-        DWT->CYCCNT = 0;
-        DWT->CTRL |= DWT_CTRL_CYCEVTENA_Msk;
+        start = DWT->CYCCNT;
     }
 
     uint32_t DataWatchPointAndTrace::Stop() const
     {
-        uint32_t cycles = DWT->CYCCNT;
-        DWT->CTRL &= ~DWT_CTRL_CYCEVTENA_Msk;
-        return cycles;
+        return DWT->CYCCNT - start;
+    }
+
+    uint32_t DataWatchPointAndTrace::CycleCount() const
+    {
+        return DWT->CYCCNT;
     }
 }
@@ -12,7 +12,15 @@ namespace hal
         DataWatchPointAndTrace();
         ~DataWatchPointAndTrace();
 
+        // Cycles between Start and Stop. The counter keeps running, so that other users
+        // of CycleCount are not disturbed.
         void Start() const;
         uint32_t Stop() const;
+
+        // The free-running cycle counter, for measuring intervals by difference
+        uint32_t CycleCount() const;
+
+    private:
+        mutable uint32_t start = 0;
     };
 }
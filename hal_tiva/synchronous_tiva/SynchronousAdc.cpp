@@ -1,6 +1,9 @@
 #include "hal_tiva/synchronous_tiva/SynchronousAdc.hpp"
 #include "infra/util/EnumCast.hpp"
 #include "infra/util/ReallyAssert.hpp"
+#include <algorithm>
+
+extern "C" uint32_t SystemCoreClock;
 
 namespace
 {
@@ -88,15 +91,13 @@ namespace
         adc.ISC = 1 << sequencer;
     }
 
-    void DataGet(ADC0_Type& adc, uint8_t sequencer, infra::BoundedVector<uint16_t>& samples, std::size_t numberOfSamples)
+    void DataGet(ADC0_Type& adc, uint8_t sequencer, uint16_t* samples, std::size_t numberOfSamples)
     {
         volatile uint32_t* SSFSTAT = &adc.SSFSTAT0 + (sequencer * sequencerOffset);
         volatile uint32_t* SSFIFO = &adc.SSFIFO0 + (sequencer * sequencerOffset);
 
-        samples.clear();
-
         while (!((*SSFSTAT) & ADC_SSFSTAT0_EMPTY) && numberOfSamples--)
-            samples.push_back(static_cast<uint16_t>(*SSFIFO));
+            *samples++ = static_cast<uint16_t>(*SSFIFO);
     }
 }
 
@@ -106,8 +107,9 @@ namespace hal::tiva
         : adcIndex(adcIndex)
         , adcSequencer(adcSequencer)
         , numberOfInputs(inputs.size())
+        , cycleCounter(config.cycleCounter)
     {
-        really_assert(inputs.size() > 0);
+        really_assert(inputs.size() > 0 && inputs.size() <= maxSamples);
         really_assert(adcIndex < peripheralAdc.size());
 
         EnableClock();
@@ -133,24 +135,54 @@ namespace hal::tiva
         DisableClock();
     }
 
-    SynchronousAdc::Samples SynchronousAdc::Measure(std::size_t)
+    SynchronousAdc::Samples SynchronousAdc::Measure(std::size_t numberOfSamples)
+    {
+        auto sequences = std::clamp<std::size_t>(numberOfSamples, 1, maxSamples / numberOfInputs);
+
+        buffer.resize(sequences * numberOfInputs);
+        return Measure(infra::MakeRange(buffer));
+    }
+
+    SynchronousAdc::Samples SynchronousAdc::Measure(Samples samples)
     {
-        buffer.clear();
+        really_assert(!samples.empty() && samples.size() % numberOfInputs == 0);
+
+        auto& adc = *peripheralAdc[adcIndex];
+
+        auto start = cycleCounter != nullptr ? cycleCounter->CycleCount() : 0;
 
-        SequenceEnable(*peripheralAdc[adcIndex], adcSequencer);
-        InterruptClear(*peripheralAdc[adcIndex], adcSequencer);
+        SequenceEnable(adc, adcSequencer);
+        InterruptClear(adc, adcSequencer);
 
-        peripheralAdc[adcIndex]->PSSI = (1 << adcSequencer);
+        adc.PSSI = (1 << adcSequencer);
 
-        while (!IsInterruptTriggered(*peripheralAdc[adcIndex], adcSequencer))
+        for (auto sequence = samples.begin(); sequence != samples.end(); sequence += numberOfInputs)
         {
+            while (!IsInterruptTriggered(adc, adcSequencer))
+            {
+            }
+
+            InterruptClear(adc, adcSequencer);
+
+            // The next run converts while this one is read from the FIFO
+            if (sequence + numberOfInputs != samples.end())
+                adc.PSSI = (1 << adcSequencer);
+
+            DataGet(adc, adcSequencer, sequence, numberOfInputs);
         }
 
-        InterruptClear(*peripheralAdc[adcIndex], adcSequencer);
-        DataGet(*peripheralAdc[adcIndex], adcSequencer, buffer, numberOfInputs);
-        SequenceDisable(*peripheralAdc[adcIndex], adcSequencer);
+        auto end = cycleCounter != nullptr ? cycleCounter->CycleCount() : 0;
+        SequenceDisable(adc, adcSequencer);
 
-        return infra::MakeRange(buffer);
+        if (cycleCounter != nullptr)
+            sampleRate = static_cast<uint32_t>(static_cast<uint64_t>(SystemCoreClock) * (samples.size() / numberOfInputs) / std::max<uint32_t>(end - start, 1));
+
+        return samples;
+    }
+
+    uint32_t SynchronousAdc::SampleRate() const
+    {
+        return sampleRate;
     }
 
     void SynchronousAdc::EnableClock() const
@@ -2,6 +2,7 @@
 #define HAL_SYNCHRONOUS_ADC_TIVA_HPP
 
 #include "hal/synchronous_interfaces/SynchronousAdc.hpp"
+#include "hal_tiva/cortex/DataWatchpointAndTrace.hpp"
 #include "hal_tiva/tiva/Gpio.hpp"
 #include "infra/util/BoundedVector.hpp"
 #include <cstdint>
@@ -13,6 +14,8 @@ namespace hal::tiva
         : public hal::SynchronousAdc
     {
     public:
+        constexpr static uint32_t maxSamples = 23;
+
         enum class SampleAndHold : uint8_t
         {
             sampleAndHold4,
@@ -47,24 +50,34 @@ namespace hal::tiva
             SampleAndHold sampleAndHold;
             Priority priority;
             std::optional<Oversampling> oversampling;
+            const hal::DataWatchPointAndTrace* cycleCounter = nullptr; // Times Measure for SampleRate when given
         };
 
         SynchronousAdc(uint8_t adcIndex, uint8_t adcSequencer, infra::MemoryRange<AnalogPin> inputs, const Config& config);
         ~SynchronousAdc();
 
+        // Measures numberOfSamples sequences into an internal buffer, which holds at most
+        // maxSamples samples; the result is limited to the whole sequences that fit, and
+        // holds at least one. Use Measure(Samples) for larger acquisitions.
         Samples Measure(std::size_t numberOfSamples) override;
 
+        // Fills samples with consecutive sequences, without intermediate copies
+        Samples Measure(Samples samples);
+
+        // Sequences per second achieved by the last Measure, or 0 without Config::cycleCounter
+        uint32_t SampleRate() const;
+
     private:
         void EnableClock() const;
         void DisableClock() const;
 
     private:
-        constexpr static uint32_t maxSamples = 23;
-
         uint8_t adcIndex;
         uint8_t adcSequencer;
         std::size_t numberOfInputs;
+        const hal::DataWatchPointAndTrace* cycleCounter;
         infra::BoundedVector<uint16_t>::WithMaxSize<maxSamples> buffer;
+        uint32_t sampleRate = 0;
     };
 }
 
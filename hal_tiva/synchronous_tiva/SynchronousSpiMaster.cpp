@@ -1,5 +1,6 @@
 #include "hal_tiva/synchronous_tiva/SynchronousSpiMaster.hpp"
 #include "infra/util/BitLogic.hpp"
+#include <algorithm>
 
 extern "C" uint32_t SystemCoreClock;
 
@@ -7,29 +8,6 @@ namespace hal::tiva
 {
     namespace
     {
-        constexpr const uint32_t SSI_CR0_SCR_M = 0x0000FF00;     // SSI Serial Clock Rate
-        constexpr const uint32_t SSI_CR0_SPH_SPO_M = 0x000000C0; // SSI Serial Clock Rate
-        constexpr const uint32_t SSI_CR0_SPH = 0x00000080;       // SSI Serial Clock Phase
-        constexpr const uint32_t SSI_CR0_SPO = 0x00000040;       // SSI Serial Clock Polarity
-        constexpr const uint32_t SSI_CR0_FRF_M = 0x00000030;     // SSI Frame Format Select
-        constexpr const uint32_t SSI_CR0_FRF_MOTO = 0x00000000;  // Freescale SPI Frame Format
-        constexpr const uint32_t SSI_CR0_FRF_TI = 0x00000010;    // Synchronous Serial Frame Format
-        constexpr const uint32_t SSI_CR0_DSS_M = 0x0000000F;     // SSI Data Size Select
-        constexpr const uint32_t SSI_CR0_DSS_4 = 0x00000003;     // 4-bit data
-        constexpr const uint32_t SSI_CR0_DSS_5 = 0x00000004;     // 5-bit data
-        constexpr const uint32_t SSI_CR0_DSS_6 = 0x00000005;     // 6-bit data
-        constexpr const uint32_t SSI_CR0_DSS_7 = 0x00000006;     // 7-bit data
-        constexpr const uint32_t SSI_CR0_DSS_8 = 0x00000007;     // 8-bit data
-        constexpr const uint32_t SSI_CR0_DSS_9 = 0x00000008;     // 9-bit data
-        constexpr const uint32_t SSI_CR0_DSS_10 = 0x00000009;    // 10-bit data
-        constexpr const uint32_t SSI_CR0_DSS_11 = 0x0000000A;    // 11-bit data
-        constexpr const uint32_t SSI_CR0_DSS_12 = 0x0000000B;    // 12-bit data
-        constexpr const uint32_t SSI_CR0_DSS_13 = 0x0000000C;    // 13-bit data
-        constexpr const uint32_t SSI_CR0_DSS_14 = 0x0000000D;    // 14-bit data
-        constexpr const uint32_t SSI_CR0_DSS_15 = 0x0000000E;    // 15-bit data
-        constexpr const uint32_t SSI_CR0_DSS_16 = 0x0000000F;    // 16-bit data
-        constexpr const uint32_t SSI_CR0_SCR_S = 8;
-
         constexpr const uint32_t SSI_CR1_EOM = 0x00000800;         // Stop Frame (End of Message)
         constexpr const uint32_t SSI_CR1_FSSHLDFRM = 0x00000400;   // FSS Hold Frame
         constexpr const uint32_t SSI_CR1_HSCLKEN = 0x00000200;     // High Speed Clock Enable
@@ -52,9 +30,6 @@ namespace hal::tiva
         constexpr const uint32_t SSI_SR_TNF = 0x00000002; // SSI Transmit FIFO Not Full
         constexpr const uint32_t SSI_SR_TFE = 0x00000001; // SSI Transmit FIFO Empty
 
-        constexpr const uint32_t SSI_CPSR_CPSDVSR_M = 0x000000FF; // SSI Clock Prescale Divisor
-        constexpr const uint32_t SSI_CPSR_CPSDVSR_S = 0;
-
         constexpr const uint32_t SSI_IM_EOTIM = 0x00000040;   // End of Transmit Interrupt Mask
         constexpr const uint32_t SSI_IM_DMATXIM = 0x00000020; // SSI Transmit DMA Interrupt Mask
         constexpr const uint32_t SSI_IM_DMARXIM = 0x00000010; // SSI Receive DMA Interrupt Mask
@@ -99,18 +74,9 @@ namespace hal::tiva
         constexpr const uint32_t SSI_CC_CS_SYSPLL = 0x00000000; // System clock (based on clocksource and divisor factor)
         constexpr const uint32_t SSI_CC_CS_PIOSC = 0x00000005;  // PIOSC
 
-        constexpr uint32_t phase_polarity(bool phase1st, bool polarityLow)
-        {
-            uint32_t phasePolarity = 0;
-
-            if (!phase1st)
-                phasePolarity |= SSI_CR0_SPH;
-
-            if (!polarityLow)
-                phasePolarity |= SSI_CR0_SPO;
-
-            return phasePolarity;
-        }
+        // Depth of both the TX and RX FIFO. Never having more frames in flight
+        // than this guarantees that the RX FIFO cannot overrun.
+        constexpr const std::size_t fifoDepth = 8;
 
         constexpr std::array<uint32_t, 4> peripheralSsiArray = { {
             SSI0_BASE,
@@ -127,34 +93,22 @@ namespace hal::tiva
         , clock(clock, PinConfigPeripheral::spiClock)
         , miso(miso, PinConfigPeripheral::spiMiso)
         , mosi(mosi, PinConfigPeripheral::spiMosi)
+        , format{ config.polarityLow, config.phase1st, 8, CalculateSsiClockRate(SystemCoreClock, config.baudRate) }
+        , wideFrames(config.wideFrames)
     {
         ssiArray = peripheralSsi;
 
         EnableClock();
 
-        auto max = SystemCoreClock / config.baudRate;
-        uint32_t div = 0;
-        uint32_t scr = 0;
-        do
-        {
-            div += 2;
-            scr = (max / div) - 1;
-        } while (scr > 255);
-
-        ssiArray[ssiIndex]->CR1 &= ~SSI_CR1_SSE;                                                                                        /* Disable SPI */
-        ssiArray[ssiIndex]->CC = SSI_CC_CS_SYSPLL;                                                                                      /* SSI clock is sourced by main system clock  */
-        ssiArray[ssiIndex]->CR1 &= ~SSI_CR1_MS;                                                                                         /* Enable master mode */
-        ssiArray[ssiIndex]->CR0 = (ssiArray[ssiIndex]->CR0 & ~SSI_CR0_DSS_M) | SSI_CR0_DSS_8;                                           /* Configure number of bits */
-        ssiArray[ssiIndex]->CR0 = (ssiArray[ssiIndex]->CR0 & ~SSI_CR0_FRF_M) | SSI_CR0_FRF_MOTO;                                        /* Configure to SPI freescale format */
-        ssiArray[ssiIndex]->CR0 = (ssiArray[ssiIndex]->CR0 & ~SSI_CR0_SPH_SPO_M) | phase_polarity(config.phase1st, config.polarityLow); /* Configure SPI phase/polarity */
-        ssiArray[ssiIndex]->CR0 = (ssiArray[ssiIndex]->CR0 & ~SSI_CR0_SCR_M) | ((scr & 0xFF) << SSI_CR0_SCR_S);                         /* Sets clock rate */
-        ssiArray[ssiIndex]->CPSR = (ssiArray[ssiIndex]->CPSR & ~SSI_CPSR_CPSDVSR_M) | div & 0xff;                                       /* Sets prescaler */
+        ssiArray[ssiIndex]->CR1 &= ~SSI_CR1_SSE;   /* Disable SPI */
+        ssiArray[ssiIndex]->CC = SSI_CC_CS_SYSPLL; /* SSI clock is sourced by main system clock  */
+        ssiArray[ssiIndex]->CR1 &= ~SSI_CR1_MS;    /* Enable master mode */
+        ConfigureSsi(*ssiArray[ssiIndex], format);
 
         ssiArray[ssiIndex]->CR1 |= SSI_CR1_SSE; /* Enable SPI */
 
-        while ((ssiArray[ssiIndex]->SR & SSI_SR_RNE))
-        {
-        }
+        while ((ssiArray[ssiIndex]->SR & SSI_SR_RNE) != 0)
+            static_cast<void>(ssiArray[ssiIndex]->DR);
     }
 
     SynchronousSpiMaster::~SynchronousSpiMaster()
@@ -167,36 +121,67 @@ namespace hal::tiva
     {
         really_assert(sendData.size() == receiveData.size() || sendData.empty() || receiveData.empty());
 
-        for (std::size_t i = 0; i < sendData.size(); i++)
-        {
-            Send(sendData.empty() ? 0 : sendData[i]);
-            auto data = Receive();
+        auto size = std::max(sendData.size(), receiveData.size());
+        SetFrameSize(wideFrames && size % 2 == 0 ? 16 : 8);
+
+        std::size_t framesToSend = size / bytesPerFrame;
+        std::size_t framesToReceive = framesToSend;
 
-            if (!receiveData.empty())
-                receiveData[i] = data;
+        // Keep the TX FIFO topped up while draining RX, so that the bus
+        // does not idle between frames
+        while (framesToReceive != 0)
+        {
+            while (framesToSend != 0 && framesToReceive - framesToSend < fifoDepth)
+            {
+                ssiArray[ssiIndex]->DR = NextFrame(sendData);
+                --framesToSend;
+            }
+
+            if ((ssiArray[ssiIndex]->SR & SSI_SR_RNE) != 0)
+            {
+                StoreFrame(receiveData, ssiArray[ssiIndex]->DR);
+                --framesToReceive;
+            }
         }
+    }
 
-        while (ssiArray[ssiIndex]->SR & SSI_SR_BSY)
+    void SynchronousSpiMaster::SetFrameSize(uint8_t dataSize)
+    {
+        if (format.dataSize != dataSize)
         {
+            format.dataSize = dataSize;
+            bytesPerFrame = dataSize > 8 ? 2 : 1;
+            ConfigureSsi(*ssiArray[ssiIndex], format);
         }
     }
 
-    void SynchronousSpiMaster::Send(uint8_t data)
+    // Frames are shifted out most significant bit first, so the first byte
+    // of a pair goes in the upper half to keep the byte order on the bus
+    uint32_t SynchronousSpiMaster::NextFrame(infra::ConstByteRange& sendData) const
     {
-        while (!(ssiArray[ssiIndex]->SR & SSI_SR_TNF))
+        uint32_t frame = 0;
+
+        for (std::size_t i = 0; i != bytesPerFrame; ++i)
         {
+            frame <<= 8;
+
+            if (!sendData.empty())
+            {
+                frame |= sendData.front();
+                sendData.pop_front();
+            }
         }
 
-        ssiArray[ssiIndex]->DR = data;
+        return frame;
     }
 
-    uint8_t SynchronousSpiMaster::Receive()
+    void SynchronousSpiMaster::StoreFrame(infra::ByteRange& receiveData, uint32_t frame) const
     {
-        while (!(ssiArray[ssiIndex]->SR & SSI_SR_RNE))
+        for (std::size_t i = bytesPerFrame; i != 0 && !receiveData.empty(); --i)
         {
+            receiveData.front() = static_cast<uint8_t>(frame >> (8 * (i - 1)));
+            receiveData.pop_front();
         }
-
-        return ssiArray[ssiIndex]->DR;
     }
 
     void SynchronousSpiMaster::EnableClock()
@@ -3,6 +3,7 @@
 
 #include "hal/synchronous_interfaces/SynchronousSpi.hpp"
 #include "hal_tiva/tiva/Gpio.hpp"
+#include "hal_tiva/tiva/Ssi.hpp"
 
 namespace hal::tiva
 {
@@ -12,15 +13,17 @@ namespace hal::tiva
     public:
         struct Config
         {
-            constexpr Config(bool polarityLow = true, bool phase1st = true, uint32_t baudRate = 100000)
+            constexpr Config(bool polarityLow = true, bool phase1st = true, uint32_t baudRate = 100000, bool wideFrames = false)
                 : polarityLow(polarityLow)
                 , phase1st(phase1st)
                 , baudRate(baudRate)
+                , wideFrames(wideFrames)
             {}
 
             bool polarityLow = true;
             bool phase1st = true;
             uint32_t baudRate = 100000;
+            bool wideFrames = false; // Even-length transfers are clocked as 16-bit frames, without a gap between byte pairs
         };
 
         SynchronousSpiMaster(uint8_t aSpiIndex, GpioPin& clock, GpioPin& miso, GpioPin& mosi, const Config& config = Config());
@@ -33,8 +36,9 @@ namespace hal::tiva
         void EnableClock();
         void DisableClock();
 
-        void Send(uint8_t data);
-        uint8_t Receive();
+        void SetFrameSize(uint8_t dataSize);
+        uint32_t NextFrame(infra::ConstByteRange& sendData) const;
+        void StoreFrame(infra::ByteRange& receiveData, uint32_t frame) const;
 
     private:
         uint8_t ssiIndex;
@@ -43,6 +47,9 @@ namespace hal::tiva
         PeripheralPin mosi;
 
         infra::MemoryRange<SSI0_Type* const> ssiArray;
+        SsiFormat format;
+        bool wideFrames;
+        std::size_t bytesPerFrame = 1;
     };
 
 }
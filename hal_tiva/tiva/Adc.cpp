@@ -3,6 +3,8 @@
 #include "infra/util/EnumCast.hpp"
 #include "infra/util/ReallyAssert.hpp"
 
+extern "C" uint32_t SystemCoreClock;
+
 namespace
 {
     extern "C" void Adc0Sequence0_Handler()
@@ -69,6 +71,14 @@ namespace
     constexpr static uint32_t ADC_TRIGGER_PWM_MOD0 = 0x00000000;
     constexpr static uint32_t ADC_TRIGGER_PWM_MOD1 = 0x00000010;
 
+    constexpr static uint32_t TIMER_CFG_32_BIT_TIMER = 0x00000000;
+    constexpr static uint32_t TIMER_TAMR_TAMR_PERIOD = 0x00000002;
+    constexpr static uint32_t TIMER_CTL_TAOTE = 0x00000020;
+    constexpr static uint32_t TIMER_CTL_TAEN = 0x00000001;
+#if defined(TM4C129)
+    constexpr static uint32_t TIMER_ADCEV_TATOADCEN = 0x00000001;
+#endif
+
     constexpr static uint32_t ADC_CTL_IE = 0x00000040;
     constexpr static uint32_t ADC_CTL_END = 0x00000020;
 
@@ -87,9 +97,21 @@ namespace
 
     constexpr static uint32_t ADC_DCCTL_CTC_LOW = 0x00000000;
     constexpr static uint32_t ADC_DCCTL_CTC_MID = 0x00000400;
-    constexpr static uint32_t ADC_DCCTL_CTC_HIGH = 0x00000800;
+    constexpr static uint32_t ADC_DCCTL_CTC_HIGH = 0x00000C00;
 
     constexpr static uint32_t ADC_DCCTL_CTE = 0x00001000;
+    constexpr static uint32_t ADC_DCCTL_CIE = 0x00000010;
+
+    constexpr static uint32_t ADC_DCCTL_CIC_LOW = 0x00000000;
+    constexpr static uint32_t ADC_DCCTL_CIC_MID = 0x00000004;
+    constexpr static uint32_t ADC_DCCTL_CIC_HIGH = 0x0000000C;
+
+    constexpr static uint32_t ADC_PSSI_GSYNC = 0x80000000;
+    constexpr static uint32_t ADC_PSSI_SYNCWAIT = 0x08000000;
+
+    constexpr static uint32_t ADC_RIS_INRDC = 0x00010000;
+    constexpr static uint32_t ADC_IM_DCONSS0 = 0x00010000;
+    constexpr static uint32_t ADC_ISC_DCINSS0 = 0x00010000;
 
     constexpr std::array<uint32_t, 2> peripheralAdcArray = { {
         ADC0_BASE,
@@ -108,11 +130,27 @@ namespace
         ADC1SS3_IRQn,
     } };
 
-    constexpr std::array<uint32_t, 4> triggerFields = { {
+    constexpr std::array<uint32_t, 11> triggerFields = { {
         ADC_TRIGGER_PWM0,
         ADC_TRIGGER_PWM1,
         ADC_TRIGGER_PWM2,
         ADC_TRIGGER_PWM3,
+        ADC_TRIGGER_PROCESSOR,
+        ADC_TRIGGER_COMP0,
+        ADC_TRIGGER_COMP1,
+        ADC_TRIGGER_COMP2,
+        ADC_TRIGGER_EXTERNAL,
+        ADC_TRIGGER_TIMER,
+        ADC_TRIGGER_ALWAYS,
+    } };
+
+    constexpr std::array<uint32_t, 6> peripheralTimerArray = { {
+        TIMER0_BASE,
+        TIMER1_BASE,
+        TIMER2_BASE,
+        TIMER3_BASE,
+        TIMER4_BASE,
+        TIMER5_BASE,
     } };
 
     constexpr std::array<uint32_t, 7> sampleAndHoldFields = { {
@@ -138,6 +176,14 @@ namespace
         ADC_DCCTL_CTC_HIGH,
     } };
 
+    constexpr std::array<uint32_t, 3> comparatorInterruptConditionFields = { {
+        ADC_DCCTL_CIC_LOW,
+        ADC_DCCTL_CIC_MID,
+        ADC_DCCTL_CIC_HIGH,
+    } };
+
+    constexpr static uint32_t ADC_DCCTL_CIM_S = 0;
+
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) - hardware register access
     const std::array<ADC0_Type*, 2> peripheralAdc = { {
         reinterpret_cast<ADC0_Type*>(ADC0_BASE),
@@ -206,6 +252,37 @@ namespace
         adc.SAC = oversampling;
     }
 
+    TIMER0_Type& Timer(uint8_t timerIndex)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) - hardware register access
+        return *reinterpret_cast<TIMER0_Type*>(peripheralTimerArray.at(timerIndex));
+    }
+
+    // Returns whether the timer clock was enabled here, rather than by another user of the timer
+    bool TimerConfigure(uint8_t timerIndex, uint32_t sampleRate)
+    {
+        really_assert(sampleRate > 0 && sampleRate <= SystemCoreClock);
+
+        bool clockEnabled = (SYSCTL->RCGCTIMER & (1 << timerIndex)) == 0;
+        SYSCTL->RCGCTIMER |= 1 << timerIndex;
+
+        while ((SYSCTL->PRTIMER & (1 << timerIndex)) == 0)
+        {
+        }
+
+        auto& timer = Timer(timerIndex);
+        timer.CTL = 0;
+        timer.CFG = TIMER_CFG_32_BIT_TIMER;
+        timer.TAMR = TIMER_TAMR_TAMR_PERIOD;
+        timer.TAILR = SystemCoreClock / sampleRate - 1;
+#if defined(TM4C129)
+        timer.ADCEV = TIMER_ADCEV_TATOADCEN;
+#endif
+        timer.CTL = TIMER_CTL_TAOTE;
+
+        return clockEnabled;
+    }
+
     void InterruptEnable(ADC0_Type& adc, uint8_t sequencer)
     {
         adc.ISC = 1 << sequencer;
@@ -219,7 +296,7 @@ namespace
 
     [[gnu::always_inline]] inline bool IsInterruptTriggered(ADC0_Type& adc, uint8_t sequencer)
     {
-        return (adc.RIS) & (0x10000 | (1 << sequencer));
+        return (adc.RIS) & (1 << sequencer);
     }
 
     [[gnu::always_inline]] inline void InterruptClear(ADC0_Type& adc, uint8_t sequencer)
@@ -282,16 +359,24 @@ namespace
             (static_cast<uint32_t>(dc.highThreshold) << 16)
             | static_cast<uint32_t>(dc.lowThreshold);
 
-        *(&adc.DCCTL0 + dc.comparatorIndex) =
-            comparatorTriggerModeFields.at(infra::enum_cast(dc.triggerMode))
-            | comparatorTriggerConditionFields.at(infra::enum_cast(dc.triggerCondition))
-            | ADC_DCCTL_CTE;
+        uint32_t dcctl = comparatorTriggerModeFields.at(infra::enum_cast(dc.triggerMode))
+                         | comparatorTriggerConditionFields.at(infra::enum_cast(dc.triggerCondition));
+
+        if (dc.triggerPwm)
+            dcctl |= ADC_DCCTL_CTE;
+
+        if (dc.interruptCondition)
+            dcctl |= (static_cast<uint32_t>(infra::enum_cast(dc.interruptMode)) << ADC_DCCTL_CIM_S)
+                     | comparatorInterruptConditionFields.at(infra::enum_cast(*dc.interruptCondition))
+                     | ADC_DCCTL_CIE;
+
+        *(&adc.DCCTL0 + dc.comparatorIndex) = dcctl;
     }
 
     void ConfigureSequencerStepDc(volatile uint32_t* ssdc, volatile uint32_t* ssop, std::size_t step, uint8_t comparatorIndex)
     {
         const auto nibbleShift = step * 4;
-        const auto bitShift = step;
+        const auto bitShift = step * 4;
 
         if (comparatorIndex == hal::tiva::Adc::DigitalComparatorConfig::noComparator)
         {
@@ -325,20 +410,14 @@ namespace
 namespace hal::tiva
 {
     Adc::Adc(uint8_t adcIndex, uint8_t adcSequencer, infra::MemoryRange<AnalogPin> inputs, const Config& config)
-        : ImmediateInterruptHandler(peripheralIrqAdcArray[numberOfSequencers * adcIndex + adcSequencer], [this]()
-              {
-                  auto& adc = *peripheralAdc[this->adcIndex];
-                  if (IsInterruptTriggered(adc, this->adcSequencer))
-                  {
-                      InterruptClear(adc, this->adcSequencer);
-                      DataGet(adc, this->adcSequencer, buffer, numberOfChannels);
-                      if (callback)
-                          callback(infra::MakeRange(buffer));
-                  }
-              })
-        , adcIndex(adcIndex)
+        : adcIndex(adcIndex)
         , adcSequencer(adcSequencer)
         , numberOfChannels(inputs.size())
+        , trigger(config.trigger)
+        , interruptRegistration(peripheralIrqAdcArray[numberOfSequencers * adcIndex + adcSequencer], [this]()
+              {
+                  HandleInterrupt();
+              })
     {
         really_assert(inputs.size() > 0);
 
@@ -347,13 +426,27 @@ namespace hal::tiva
         SequenceDisable(*peripheralAdc[adcIndex], adcSequencer);
         SequenceConfigure(*peripheralAdc[adcIndex], adcSequencer, config.trigger, config.priority);
 
+        if (!config.digitalComparators.empty())
+        {
+            ValidateDigitalComparators(config.digitalComparators, inputs.size());
+            numberOfChannels = CountFifoSteps(config.digitalComparators);
+        }
+
         auto lastChannel = inputs.size() - 1;
         auto sh = sampleAndHoldFields.at(infra::enum_cast(config.sampleAndHold));
+        // Without FIFO steps there is nothing to read, so the sequence does not interrupt
+        auto ie = numberOfChannels != 0 ? ADC_CTL_IE : 0;
 
         for (std::size_t i = 0; i < inputs.size() - 1; i++)
             SequenceStepConfigure(*peripheralAdc[adcIndex], adcSequencer, i, inputs[i].AdcChannel() | sh);
 
-        SequenceStepConfigure(*peripheralAdc[adcIndex], adcSequencer, lastChannel, inputs[lastChannel].AdcChannel() | sh | ADC_CTL_IE | ADC_CTL_END);
+        SequenceStepConfigure(*peripheralAdc[adcIndex], adcSequencer, lastChannel, inputs[lastChannel].AdcChannel() | sh | ie | ADC_CTL_END);
+
+        if (config.trigger == Trigger::timer && config.timer)
+        {
+            timerIndex = config.timer->timerIndex;
+            timerClockEnabled = TimerConfigure(*timerIndex, config.timer->sampleRate);
+        }
 
         if (config.oversampling)
             SequenceOversampling(*peripheralAdc[adcIndex], infra::enum_cast(*config.oversampling));
@@ -362,31 +455,117 @@ namespace hal::tiva
             SetPhaseDelay(adcIndex, config.samplingDelay->Value());
 
         if (!config.digitalComparators.empty())
-        {
-            ValidateDigitalComparators(config.digitalComparators, inputs.size());
-            numberOfChannels = CountFifoSteps(config.digitalComparators);
             ConfigureDigitalComparators(*peripheralAdc[adcIndex], adcSequencer, config.digitalComparators);
-        }
+
+        for (const auto& dc : config.digitalComparators)
+            if (dc.comparatorIndex != DigitalComparatorConfig::noComparator && dc.interruptCondition)
+            {
+                comparatorMask |= 1 << dc.comparatorIndex;
+                comparatorBands[dc.comparatorIndex] = *dc.interruptCondition;
+            }
     }
 
     Adc::~Adc()
     {
         SequenceDisable(*peripheralAdc[adcIndex], adcSequencer);
         InterruptDisable(*peripheralAdc[adcIndex], adcSequencer);
+
+        StopTimer();
+
+        if (timerIndex && timerClockEnabled)
+            SYSCTL->RCGCTIMER &= ~(1 << *timerIndex);
+
         DisableClock();
     }
 
     void Adc::Measure(const infra::Function<void(Samples)>& onDone)
     {
-        callback = onDone;
-        InterruptEnable(*peripheralAdc[adcIndex], adcSequencer);
-        SequenceEnable(*peripheralAdc[adcIndex], adcSequencer);
+        Start(onDone, 0);
+    }
+
+    void Adc::MeasureSynchronized(const infra::Function<void(Samples)>& onDone)
+    {
+        Start(onDone, ADC_PSSI_SYNCWAIT);
+    }
+
+    void Adc::Synchronize()
+    {
+        peripheralAdc[adcIndex]->PSSI = ADC_PSSI_GSYNC;
     }
 
     void Adc::Stop()
     {
+        StopTimer();
         SequenceDisable(*peripheralAdc[adcIndex], adcSequencer);
         InterruptDisable(*peripheralAdc[adcIndex], adcSequencer);
+        peripheralAdc[adcIndex]->IM &= ~(ADC_IM_DCONSS0 << adcSequencer);
+    }
+
+    void Adc::MonitorComparators(const infra::Function<void(ComparatorEvent event)>& onEvent)
+    {
+        really_assert(comparatorMask != 0);
+
+        auto& adc = *peripheralAdc[adcIndex];
+        onComparatorEvent = onEvent;
+
+        adc.DCISC = comparatorMask;
+        adc.ISC = ADC_ISC_DCINSS0 << adcSequencer;
+        adc.IM |= ADC_IM_DCONSS0 << adcSequencer;
+        SequenceEnable(adc, adcSequencer);
+        StartTimer();
+    }
+
+    void Adc::HandleInterrupt()
+    {
+        auto& adc = *peripheralAdc[adcIndex];
+
+        if (comparatorMask != 0 && (adc.RIS & ADC_RIS_INRDC) != 0)
+            HandleComparatorInterrupt();
+
+        if (IsInterruptTriggered(adc, adcSequencer))
+        {
+            InterruptClear(adc, adcSequencer);
+            DataGet(adc, adcSequencer, buffer, numberOfChannels);
+            if (callback)
+                callback(infra::MakeRange(buffer));
+        }
+    }
+
+    void Adc::HandleComparatorInterrupt()
+    {
+        auto& adc = *peripheralAdc[adcIndex];
+        auto status = adc.DCISC & comparatorMask;
+
+        adc.DCISC = status;
+        adc.ISC = ADC_ISC_DCINSS0 << adcSequencer;
+
+        for (uint8_t comparator = 0; status != 0; ++comparator, status >>= 1)
+            if ((status & 1) != 0 && onComparatorEvent)
+                onComparatorEvent(ComparatorEvent{ comparator, comparatorBands[comparator] });
+    }
+
+    void Adc::StartTimer()
+    {
+        if (timerIndex)
+            Timer(*timerIndex).CTL |= TIMER_CTL_TAEN;
+    }
+
+    void Adc::StopTimer()
+    {
+        if (timerIndex)
+            Timer(*timerIndex).CTL &= ~TIMER_CTL_TAEN;
+    }
+
+    void Adc::Start(const infra::Function<void(Samples)>& onDone, uint32_t processorTrigger)
+    {
+        callback = onDone;
+        InterruptEnable(*peripheralAdc[adcIndex], adcSequencer);
+        SequenceEnable(*peripheralAdc[adcIndex], adcSequencer);
+
+        if (trigger == Trigger::processor)
+            peripheralAdc[adcIndex]->PSSI = processorTrigger | (1 << adcSequencer);
+
+        StartTimer();
     }
 
     void Adc::EnableClock()
@@ -12,7 +12,6 @@ namespace hal::tiva
 {
     class Adc
         : public hal::AdcMultiChannel
-        , private hal::ImmediateInterruptHandler
     {
     public:
         enum class Trigger : uint8_t
@@ -21,6 +20,19 @@ namespace hal::tiva
             pwmGenerator1,
             pwmGenerator2,
             pwmGenerator3,
+            processor,   // Every call to Measure starts a single sequence
+            comparator0, // Configured by AnalogComparator::Config::triggerEnabled
+            comparator1,
+            comparator2,
+            gpio,        // Configured by GpioPin::EnableAdcTrigger
+            timer,       // Paced by Config::timer, or by a timer configured elsewhere when not given
+            always,
+        };
+
+        struct TimerTrigger
+        {
+            uint8_t timerIndex;  // 16/32-bit timer, used as a 32-bit periodic timer
+            uint32_t sampleRate; // Sequences per second
         };
 
         enum class SampleAndHold : uint8_t
@@ -86,6 +98,15 @@ namespace hal::tiva
             uint16_t highThreshold = 0;
             ComparatorCondition triggerCondition = ComparatorCondition::highBand;
             ComparatorMode triggerMode = ComparatorMode::always;
+            bool triggerPwm = true; // Seen by the PWM through FaultConfig::enabledComparatorInputs
+            std::optional<ComparatorCondition> interruptCondition;
+            ComparatorMode interruptMode = ComparatorMode::once;
+        };
+
+        struct ComparatorEvent
+        {
+            uint8_t comparatorIndex;
+            ComparatorCondition band;
         };
 
         struct Config
@@ -97,6 +118,7 @@ namespace hal::tiva
             std::optional<Oversampling> oversampling;
             std::optional<SamplingDelay> samplingDelay;
             infra::MemoryRange<const DigitalComparatorConfig> digitalComparators;
+            std::optional<TimerTrigger> timer;
         };
 
         Adc(uint8_t adcIndex, uint8_t adcSequencer, infra::MemoryRange<AnalogPin> inputs, const Config& config);
@@ -105,18 +127,43 @@ namespace hal::tiva
         void Measure(const infra::Function<void(Samples)>& onDone) override;
         void Stop() override;
 
+        // Like Measure, but a processor triggered sequence waits for Synchronize, which
+        // starts all sequences waiting on either ADC at the same time
+        void MeasureSynchronized(const infra::Function<void(Samples)>& onDone);
+        void Synchronize();
+
+        // Reports the comparators configured with an interruptCondition. When all inputs
+        // are routed to comparators the sequencer runs without any FIFO or CPU load.
+        void MonitorComparators(const infra::Function<void(ComparatorEvent event)>& onEvent);
+
+    protected:
+        virtual void HandleInterrupt();
+        void StartTimer();
+        void StopTimer();
+
     private:
+        void Start(const infra::Function<void(Samples)>& onDone, uint32_t processorTrigger);
         void EnableClock();
         void DisableClock();
+        void HandleComparatorInterrupt();
 
-    private:
+    protected:
         constexpr static uint32_t maxSamples = 8;
         constexpr static uint32_t numberOfSequencers = 4;
 
         uint8_t adcIndex;
         uint8_t adcSequencer;
+        std::size_t numberOfChannels;
+
+    private:
+        Trigger trigger;
+        std::optional<uint8_t> timerIndex;
+        bool timerClockEnabled = false;
         infra::Function<void(Samples)> callback;
         infra::BoundedVector<uint16_t>::WithMaxSize<maxSamples> buffer;
-        std::size_t numberOfChannels;
+        uint32_t comparatorMask = 0;
+        std::array<ComparatorCondition, 8> comparatorBands{};
+        infra::Function<void(ComparatorEvent event)> onComparatorEvent;
+        ImmediateInterruptHandler interruptRegistration;
     };
 }
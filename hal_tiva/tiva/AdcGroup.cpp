@@ -0,0 +1,97 @@
+#include "hal_tiva/tiva/AdcGroup.hpp"
+#include "infra/util/ReallyAssert.hpp"
+#include <algorithm>
+#include <iterator>
+
+namespace hal::tiva
+{
+    namespace
+    {
+        uint32_t DelayValue(const std::optional<Adc::SamplingDelay>& delay)
+        {
+            return delay ? delay->Value() : 0;
+        }
+
+        void ValidateMembers(infra::MemoryRange<const AdcGroup::Member> members)
+        {
+            for (auto first = members.begin(); first != members.end(); ++first)
+                for (auto second = std::next(first); second != members.end(); ++second)
+                    if (first->adcIndex == second->adcIndex)
+                    {
+                        // The sampling delay is a property of the ADC, not of the sequencer
+                        really_assert(first->adcSequencer != second->adcSequencer);
+                        really_assert(DelayValue(first->samplingDelay) == DelayValue(second->samplingDelay));
+                    }
+        }
+    }
+
+    AdcGroup::AdcGroup(infra::MemoryRange<const Member> members, const Adc::Config& config)
+        : trigger(config.trigger)
+    {
+        really_assert(!members.empty() && members.size() <= maxMembers);
+        really_assert(config.digitalComparators.empty());
+        really_assert(config.trigger != Adc::Trigger::timer || config.timer);
+        ValidateMembers(members);
+
+        std::size_t offset = 0;
+
+        for (std::size_t i = 0; i != members.size(); ++i)
+        {
+            const auto& member = members[i];
+            really_assert(member.inputs.size() <= maxSamplesPerMember);
+
+            auto memberConfig = config;
+            memberConfig.samplingDelay = member.samplingDelay;
+
+            // The other members are triggered by the timer of the first
+            if (i != 0)
+                memberConfig.timer = std::nullopt;
+
+            adcs.emplace_back(member.adcIndex, member.adcSequencer, member.inputs, memberConfig);
+            offsets[i] = offset;
+            offset += member.inputs.size();
+            allCompleted |= 1 << i;
+        }
+
+        frame.resize(offset);
+    }
+
+    void AdcGroup::Measure(const infra::Function<void(Samples)>& onDone)
+    {
+        this->onDone = onDone;
+        completed = 0;
+
+        // From the last member down, so that all members are armed before the first
+        // starts the timer
+        for (std::size_t i = adcs.size(); i-- != 0;)
+            adcs[i].MeasureSynchronized([this, i](Samples samples)
+                {
+                    MemberDone(i, samples);
+                });
+
+        if (trigger == Adc::Trigger::processor)
+            adcs[0].Synchronize();
+    }
+
+    void AdcGroup::Stop()
+    {
+        for (auto& adc : adcs)
+            adc.Stop();
+
+        completed = 0;
+    }
+
+    void AdcGroup::MemberDone(std::size_t index, Samples samples)
+    {
+        std::copy(samples.begin(), samples.end(), frame.begin() + offsets[index]);
+        completed |= 1 << index;
+
+        if (completed == allCompleted)
+        {
+            completed = 0;
+
+            if (onDone)
+                onDone(infra::MakeRange(frame));
+        }
+    }
+}
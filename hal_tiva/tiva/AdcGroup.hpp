@@ -0,0 +1,50 @@
+#ifndef HAL_ADC_GROUP_TIVA_HPP
+#define HAL_ADC_GROUP_TIVA_HPP
+
+#include "hal_tiva/tiva/Adc.hpp"
+#include "infra/util/BoundedVector.hpp"
+
+namespace hal::tiva
+{
+    // Sequencers of one or both ADCs started by the same trigger. The results of
+    // all members are concatenated, in member order, into a single frame which is
+    // reported once every member has completed its sequence. Processor triggered members
+    // start together through the global synchronization of the ADCs, and a timer trigger
+    // is configured once, by the first member. Members on different ADCs can be
+    // interleaved by giving them a different sampling delay.
+    class AdcGroup
+        : public hal::AdcMultiChannel
+    {
+    public:
+        static constexpr std::size_t maxMembers = 4;
+
+        struct Member
+        {
+            uint8_t adcIndex;
+            uint8_t adcSequencer;
+            infra::MemoryRange<AnalogPin> inputs;
+            std::optional<Adc::SamplingDelay> samplingDelay;
+        };
+
+        AdcGroup(infra::MemoryRange<const Member> members, const Adc::Config& config);
+
+        void Measure(const infra::Function<void(Samples)>& onDone) override;
+        void Stop() override;
+
+    private:
+        void MemberDone(std::size_t index, Samples samples);
+
+    private:
+        static constexpr std::size_t maxSamplesPerMember = 8;
+
+        Adc::Trigger trigger;
+        infra::BoundedVector<Adc>::WithMaxSize<maxMembers> adcs;
+        std::array<std::size_t, maxMembers> offsets{};
+        infra::BoundedVector<uint16_t>::WithMaxSize<maxMembers * maxSamplesPerMember> frame;
+        uint32_t completed = 0;
+        uint32_t allCompleted = 0;
+        infra::Function<void(Samples)> onDone;
+    };
+}
+
+#endif
@@ -0,0 +1,119 @@
+#include "hal_tiva/tiva/AdcProcessing.hpp"
+#include "infra/util/ReallyAssert.hpp"
+#include <algorithm>
+#include DEVICE_HEADER
+
+namespace hal::tiva
+{
+    namespace
+    {
+        constexpr const uint32_t gainShift = 12;
+        constexpr const uint32_t coefficientShift = 14;
+
+        constexpr AdcProcessing::Calibration identityCalibration{};
+
+        [[gnu::always_inline]] inline uint32_t Pack(int16_t low, int16_t high)
+        {
+            return static_cast<uint16_t>(low) | (static_cast<uint32_t>(static_cast<uint16_t>(high)) << 16);
+        }
+
+        [[gnu::always_inline]] inline uint32_t Push(uint32_t history, int16_t value)
+        {
+            return (history << 16) | static_cast<uint16_t>(value);
+        }
+
+        [[gnu::always_inline]] inline int16_t Saturate(int32_t value)
+        {
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+            return static_cast<int16_t>(__SSAT(value, 16));
+#else
+            return static_cast<int16_t>(std::clamp<int32_t>(value, INT16_MIN, INT16_MAX));
+#endif
+        }
+
+        // Returns accumulator + low(x) * low(y) + high(x) * high(y)
+        [[gnu::always_inline]] inline int32_t MultiplyAccumulateDual(uint32_t x, uint32_t y, int32_t accumulator)
+        {
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+            return static_cast<int32_t>(__SMLAD(x, y, static_cast<uint32_t>(accumulator)));
+#else
+            return accumulator + static_cast<int16_t>(x) * static_cast<int16_t>(y) + static_cast<int16_t>(x >> 16) * static_cast<int16_t>(y >> 16);
+#endif
+        }
+
+        [[gnu::always_inline]] inline int32_t Calibrate(uint16_t sample, const AdcProcessing::Calibration& calibration)
+        {
+            return Saturate(((static_cast<int32_t>(sample) - calibration.offset) * calibration.gain) >> gainShift);
+        }
+    }
+
+    AdcProcessing::AdcProcessing(infra::MemoryRange<ChannelState> channels, const Config& config)
+        : channels(channels)
+        , calibration(config.calibration)
+        , decimation(config.decimation)
+        , filtered(config.filter.has_value())
+    {
+        really_assert(!channels.empty());
+        really_assert(calibration.empty() || calibration.size() == channels.size());
+        really_assert(decimation > 0 && decimation <= 0x10000);
+
+        if (config.filter)
+        {
+            // The feedback coefficients are negated, which -2.0 in Q1.14 does not survive
+            really_assert(config.filter->a[0] != INT16_MIN && config.filter->a[1] != INT16_MIN);
+
+            b0 = config.filter->b[0];
+            b12 = Pack(config.filter->b[1], config.filter->b[2]);
+            a12 = Pack(static_cast<int16_t>(-config.filter->a[0]), static_cast<int16_t>(-config.filter->a[1]));
+        }
+    }
+
+    infra::MemoryRange<int16_t> AdcProcessing::Process(infra::MemoryRange<const uint16_t> samples, infra::MemoryRange<int16_t> output)
+    {
+        really_assert(samples.size() % channels.size() == 0);
+
+        auto produced = output.begin();
+
+        for (auto sequence = samples.begin(); sequence != samples.end(); sequence += channels.size())
+        {
+            for (std::size_t channel = 0; channel != channels.size(); ++channel)
+                channels[channel].sum += Calibrate(sequence[channel], calibration.empty() ? identityCalibration : calibration[channel]);
+
+            if (++sequences != decimation)
+                continue;
+
+            sequences = 0;
+            really_assert(static_cast<std::size_t>(output.end() - produced) >= channels.size());
+
+            for (auto& state : channels)
+            {
+                auto value = static_cast<int16_t>(state.sum / static_cast<int32_t>(decimation));
+                state.sum = 0;
+
+                *produced++ = filtered ? Filter(state, value) : value;
+            }
+        }
+
+        return infra::MakeRange(output.begin(), produced);
+    }
+
+    void AdcProcessing::Reset()
+    {
+        sequences = 0;
+        std::fill(channels.begin(), channels.end(), ChannelState());
+    }
+
+    int16_t AdcProcessing::Filter(ChannelState& state, int16_t input) const
+    {
+        int32_t accumulator = b0 * input;
+        accumulator = MultiplyAccumulateDual(state.inputHistory, b12, accumulator);
+        accumulator = MultiplyAccumulateDual(state.outputHistory, a12, accumulator);
+
+        auto result = Saturate(accumulator >> coefficientShift);
+
+        state.inputHistory = Push(state.inputHistory, input);
+        state.outputHistory = Push(state.outputHistory, result);
+
+        return result;
+    }
+}
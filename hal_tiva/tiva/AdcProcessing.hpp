@@ -0,0 +1,73 @@
+#ifndef HAL_ADC_PROCESSING_TIVA_HPP
+#define HAL_ADC_PROCESSING_TIVA_HPP
+
+#include "infra/util/MemoryRange.hpp"
+#include "infra/util/WithStorage.hpp"
+#include <array>
+#include <cstdint>
+#include <optional>
+
+namespace hal::tiva
+{
+    // Fixed-point processing of interleaved samples as delivered by Adc, AdcWithDma
+    // and SynchronousAdc. Every channel is calibrated, averaged over a number of
+    // sequences and optionally filtered by a biquad. The filter uses the dual
+    // 16-bit multiply-accumulate of the Cortex-M4 when available, and an
+    // equivalent portable implementation otherwise.
+    class AdcProcessing
+    {
+    public:
+        struct ChannelState
+        {
+            int32_t sum = 0;
+            uint32_t inputHistory = 0;
+            uint32_t outputHistory = 0;
+        };
+
+        template<std::size_t Channels>
+        using WithChannels = infra::WithStorage<AdcProcessing, std::array<ChannelState, Channels>>;
+
+        struct Calibration
+        {
+            int16_t offset = 0;    // Subtracted from the raw sample
+            int16_t gain = 0x1000; // Q3.12, applied after the offset
+        };
+
+        // Direct form I, coefficients in Q1.14:
+        // y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] - a1 y[n-1] - a2 y[n-2]
+        struct Biquad
+        {
+            std::array<int16_t, 3> b;
+            std::array<int16_t, 2> a;
+        };
+
+        struct Config
+        {
+            infra::MemoryRange<const Calibration> calibration; // One per channel, or empty
+            std::size_t decimation = 1;                         // Sequences averaged into one output
+            std::optional<Biquad> filter;
+        };
+
+        AdcProcessing(infra::MemoryRange<ChannelState> channels, const Config& config);
+
+        // samples holds whole sequences, output receives one value per channel for every
+        // decimation sequences. Returns the part of output that was written.
+        infra::MemoryRange<int16_t> Process(infra::MemoryRange<const uint16_t> samples, infra::MemoryRange<int16_t> output);
+        void Reset();
+
+    private:
+        int16_t Filter(ChannelState& state, int16_t input) const;
+
+    private:
+        infra::MemoryRange<ChannelState> channels;
+        infra::MemoryRange<const Calibration> calibration;
+        std::size_t decimation;
+        std::size_t sequences = 0;
+        bool filtered;
+        int16_t b0 = 0;
+        uint32_t b12 = 0;
+        uint32_t a12 = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef HAL_ADC_RATE_PLANNER_TIVA_HPP
+#define HAL_ADC_RATE_PLANNER_TIVA_HPP
+
+#include "hal_tiva/tiva/Adc.hpp"
+#include <array>
+#include <cstdint>
+#include <optional>
+
+namespace hal::tiva
+{
+#if defined(TM4C129)
+    constexpr uint32_t minAdcClock = 16000000;
+    constexpr uint32_t maxAdcClock = 32000000;
+#else
+    constexpr uint32_t minAdcClock = 16000000;
+    constexpr uint32_t maxAdcClock = 16000000;
+#endif
+
+    struct AdcRatePlan
+    {
+        uint8_t sequencer;
+        uint8_t fifoDepth;
+        uint32_t sequenceClocks;     // ADC clocks to convert one sequence, averaging included
+        uint32_t maxSequenceRate;    // Fastest trigger rate the sequence can follow
+        uint32_t sequencesInFifo;    // Sequences buffered before the FIFO overflows
+        uint32_t interruptLatencyNs; // Longest delay allowed before the FIFO is drained
+    };
+
+    // Not defined; reaching one of these while planning fails the compilation
+    // with the reason in the error message.
+    void AdcPlanTooManyChannels();
+    void AdcPlanNoSuchSequencer();
+    void AdcPlanClockOutOfRange();
+    void AdcPlanRateTooHigh();
+
+    // Plans the sequencer given by the caller, or the one with the deepest FIFO, so that
+    // as many sequences as possible are buffered between interrupts, and checks that a
+    // sequence converts within one trigger period. Each conversion takes the sample and
+    // hold time plus 12 ADC clocks, and is repeated by hardware averaging.
+    consteval AdcRatePlan PlanAdcRate(std::size_t channels, uint32_t sequenceRate, Adc::SampleAndHold sampleAndHold, std::optional<Adc::Oversampling> oversampling = std::nullopt, uint32_t adcClock = maxAdcClock, std::optional<uint8_t> requestedSequencer = std::nullopt)
+    {
+        constexpr std::array<uint8_t, 4> fifoDepths = { { 8, 4, 4, 1 } };
+        constexpr uint32_t conversionClocks = 12;
+
+        uint8_t sequencer = requestedSequencer.value_or(0);
+
+        if (sequencer >= fifoDepths.size())
+            AdcPlanNoSuchSequencer();
+
+        if (channels == 0 || channels > fifoDepths[sequencer])
+            AdcPlanTooManyChannels();
+
+        if (adcClock < minAdcClock || adcClock > maxAdcClock)
+            AdcPlanClockOutOfRange();
+
+        uint32_t averaging = oversampling ? 1u << static_cast<uint32_t>(*oversampling) : 1;
+        uint32_t sampleClocks = (4u << static_cast<uint32_t>(sampleAndHold)) + conversionClocks;
+        uint32_t sequenceClocks = sampleClocks * averaging * static_cast<uint32_t>(channels);
+        uint32_t maxSequenceRate = adcClock / sequenceClocks;
+
+        if (sequenceRate == 0 || sequenceRate > maxSequenceRate)
+            AdcPlanRateTooHigh();
+
+        uint32_t sequencesInFifo = fifoDepths[sequencer] / static_cast<uint32_t>(channels);
+        uint64_t periodNs = 1000000000ull / sequenceRate;
+        uint64_t sequenceNs = 1000000000ull * sequenceClocks / adcClock;
+
+        // The interrupt is raised when a sequence completes. The FIFO overflows once the
+        // conversion that no longer fits has been sampled and converted, so the budget
+        // runs from the end of that sequence up to the end of the overflowing conversion.
+        uint32_t overflowingStep = fifoDepths[sequencer] % static_cast<uint32_t>(channels);
+        uint64_t overflowNs = sequencesInFifo * periodNs + 1000000000ull * sampleClocks * averaging * (overflowingStep + 1) / adcClock;
+
+        return AdcRatePlan{ sequencer, fifoDepths[sequencer], sequenceClocks, maxSequenceRate, sequencesInFifo, static_cast<uint32_t>(overflowNs - sequenceNs) };
+    }
+}
+
+#endif
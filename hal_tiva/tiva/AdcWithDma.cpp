@@ -0,0 +1,193 @@
+#include "hal_tiva/tiva/AdcWithDma.hpp"
+#include "infra/event/EventDispatcher.hpp"
+#include "infra/util/ReallyAssert.hpp"
+
+namespace hal::tiva
+{
+    namespace
+    {
+        constexpr const uint32_t ADC_ACTSS_ASEN0 = 0x00000001;    // ADC SS0 Enable
+        constexpr const uint32_t ADC_SSCTL0_IE0 = 0x00000004;     // 1st Sample Interrupt Enable
+        constexpr const uint32_t ADC_SSOP0_S0DCOP = 0x00000001;   // Sample Digital Comparator Operation
+        constexpr const uint32_t ADC_SSFSTAT0_EMPTY = 0x00000100; // FIFO Empty
+
+#if defined(TM4C129)
+        constexpr const uint32_t ADC_ACTSS_ADEN0 = 0x00000100; // ADC SS0 DMA Enable
+        constexpr const uint32_t ADC_IM_DMAMASK0 = 0x00000100; // SS0 DMA Interrupt Mask
+        constexpr const uint32_t ADC_ISC_DMAIN0 = 0x00000100;  // SS0 DMA Interrupt Status and Clear
+
+        constexpr const uint32_t sequencerEnable = ADC_ACTSS_ASEN0 | ADC_ACTSS_ADEN0;
+#else
+        constexpr const uint32_t sequencerEnable = ADC_ACTSS_ASEN0;
+#endif
+
+        constexpr const std::size_t sequencerOffset = 8;
+
+        constexpr std::array<uint32_t, 2> peripheralAdcArray = { {
+            ADC0_BASE,
+            ADC1_BASE,
+        } };
+
+        constexpr const std::array<std::array<DmaChannel::Channel, 4>, 2> adcDmaChannels = { {
+            { { { 14, 0 }, { 15, 0 }, { 16, 0 }, { 17, 0 } } },
+            { { { 24, 1 }, { 25, 1 }, { 26, 1 }, { 27, 1 } } },
+        } };
+
+        // The sequencer only raises burst requests, one per step with IE set. Every step
+        // writing to the FIFO requests a single sample, so the blocks stay aligned to the
+        // sequence whatever its length.
+        constexpr DmaChannel::Attributes attributes{ false, false, true, false };
+        constexpr DmaChannel::ControlBlock controlBlock{ DmaChannel::Increment::none, DmaChannel::Increment::_16_bits, DmaChannel::DataSize::_16_bits, DmaChannel::ArbitrationSize::_1_item };
+    }
+
+    AdcWithDma::AdcWithDma(infra::MemoryRange<uint16_t> buffer, uint8_t adcIndex, uint8_t adcSequencer, infra::MemoryRange<AnalogPin> inputs, Dma& dma, const Config& config)
+        : Adc(adcIndex, adcSequencer, inputs, config)
+        , adc(*reinterpret_cast<ADC0_Type*>(peripheralAdcArray[adcIndex]))
+        , dmaChannel{ dma, adcDmaChannels[adcIndex][adcSequencer], DmaChannel::Configuration{ attributes, controlBlock } }
+        , halves{ { infra::MemoryRange<uint16_t>(buffer.begin(), buffer.begin() + buffer.size() / 2), infra::MemoryRange<uint16_t>(buffer.begin() + buffer.size() / 2, buffer.end()) } }
+    {
+        really_assert(numberOfChannels > 0);
+        really_assert(buffer.size() % 2 == 0);
+        really_assert(!halves[0].empty() && halves[0].size() <= dmaChannel.MaxTransferSize());
+        really_assert(halves[0].size() % numberOfChannels == 0);
+
+        volatile uint32_t* ssctl = &adc.SSCTL0 + (adcSequencer * sequencerOffset);
+        volatile uint32_t* ssop = &adc.SSOP0 + (adcSequencer * sequencerOffset);
+
+        for (std::size_t step = 0; step != inputs.size(); ++step)
+            if ((*ssop & (ADC_SSOP0_S0DCOP << (step * 4))) == 0)
+                *ssctl |= ADC_SSCTL0_IE0 << (step * 4);
+    }
+
+    AdcWithDma::~AdcWithDma()
+    {
+        Stop();
+    }
+
+    void AdcWithDma::Measure(const infra::Function<void(Samples)>& onDone)
+    {
+        onSamples = onDone;
+        onBlock = nullptr;
+        Start();
+    }
+
+    void AdcWithDma::Stream(const infra::Function<void(const Block& block)>& onBlock)
+    {
+        this->onBlock = onBlock;
+        onSamples = nullptr;
+        Start();
+    }
+
+    void AdcWithDma::Stop()
+    {
+        streaming = false;
+        StopTimer();
+
+#if defined(TM4C129)
+        adc.IM &= ~(ADC_IM_DMAMASK0 << adcSequencer);
+#endif
+        adc.ACTSS &= ~(sequencerEnable << adcSequencer);
+        dmaChannel.StopTransfer();
+        FlushFifo();
+    }
+
+    void AdcWithDma::Start()
+    {
+        really_assert(!streaming);
+
+        streaming = true;
+        overrun = false;
+        Restart();
+
+#if defined(TM4C129)
+        adc.ISC = ADC_ISC_DMAIN0 << adcSequencer;
+        adc.IM |= ADC_IM_DMAMASK0 << adcSequencer;
+#endif
+
+        StartTimer();
+    }
+
+    void AdcWithDma::Restart()
+    {
+        // The sequencer is restarted as well, so that the first sample of
+        // each block is always taken from the first step
+        adc.ACTSS &= ~(sequencerEnable << adcSequencer);
+        FlushFifo();
+        adc.OSTAT = 1 << adcSequencer;
+
+        pending = {};
+        nextAlternate = false;
+        dmaChannel.StartPingPongTransfer(Half(false), Half(true));
+
+        adc.ACTSS |= sequencerEnable << adcSequencer;
+    }
+
+    void AdcWithDma::HandleInterrupt()
+    {
+#if defined(TM4C129)
+        adc.ISC = ADC_ISC_DMAIN0 << adcSequencer;
+#endif
+
+        CheckHalf(nextAlternate);
+        CheckHalf(nextAlternate);
+    }
+
+    void AdcWithDma::CheckHalf(bool alternate)
+    {
+        auto completed = alternate ? dmaChannel.IsAlternateTransferCompleted() : dmaChannel.IsPrimaryTransferCompleted();
+
+        if (streaming && completed && !pending[alternate])
+        {
+            pending[alternate] = true;
+            nextAlternate = !alternate;
+
+            infra::EventDispatcher::Instance().Schedule([this, alternate]()
+                {
+                    Deliver(alternate);
+                });
+        }
+    }
+
+    void AdcWithDma::Deliver(bool alternate)
+    {
+        if (!streaming)
+            return;
+
+        Block block{ halves[alternate], halves[alternate].size() / numberOfChannels, overrun || (adc.OSTAT & (1 << adcSequencer)) != 0 };
+        adc.OSTAT = 1 << adcSequencer;
+        overrun = false;
+
+        if (onBlock)
+            onBlock(block);
+        else
+            onSamples(block.samples);
+
+        if (!streaming)
+            return;
+
+        dmaChannel.ReArmPingPongHalf(alternate, Half(alternate));
+        pending[alternate] = false;
+
+        // Both halves were still owned by the event loop when the DMA needed
+        // the next one, so the channel stopped and conversions were dropped
+        if (!dmaChannel.IsTransferEnabled() && !pending[!alternate])
+        {
+            overrun = true;
+            Restart();
+        }
+    }
+
+    void AdcWithDma::FlushFifo()
+    {
+        volatile uint32_t* ssfstat = &adc.SSFSTAT0 + (adcSequencer * sequencerOffset);
+        volatile uint32_t* ssfifo = &adc.SSFIFO0 + (adcSequencer * sequencerOffset);
+
+        while ((*ssfstat & ADC_SSFSTAT0_EMPTY) == 0)
+            static_cast<void>(*ssfifo);
+    }
+
+    DmaChannel::Buffers AdcWithDma::Half(bool alternate)
+    {
+        return DmaChannel::Buffers{ &adc.SSFIFO0 + (adcSequencer * sequencerOffset), halves[alternate].begin(), halves[alternate].size() };
+    }
+}
@@ -0,0 +1,62 @@
+#ifndef HAL_ADC_WITH_DMA_TIVA_HPP
+#define HAL_ADC_WITH_DMA_TIVA_HPP
+
+#include "hal_tiva/tiva/Adc.hpp"
+#include "hal_tiva/tiva/Dma.hpp"
+#include "infra/util/WithStorage.hpp"
+#include <array>
+
+namespace hal::tiva
+{
+    // Continuous acquisition of a sample sequencer through the uDMA into the two
+    // halves of buffer. Each filled half is delivered from the event loop as a block
+    // of interleaved samples, one per input per trigger, and handed back to the DMA
+    // when the callback returns.
+    class AdcWithDma
+        : public Adc
+    {
+    public:
+        template<std::size_t SamplesPerBlock>
+        using WithBuffer = infra::WithStorage<AdcWithDma, std::array<uint16_t, 2 * SamplesPerBlock>>;
+
+        struct Block
+        {
+            Samples samples;
+            std::size_t sequences;
+            bool overrun; // Samples were lost between the previous block and this one
+        };
+
+        AdcWithDma(infra::MemoryRange<uint16_t> buffer, uint8_t adcIndex, uint8_t adcSequencer, infra::MemoryRange<AnalogPin> inputs, Dma& dma, const Config& config);
+        ~AdcWithDma();
+
+        // Implementation of AdcMultiChannel, onDone is invoked for every block
+        void Measure(const infra::Function<void(Samples)>& onDone) override;
+        void Stop() override;
+
+        void Stream(const infra::Function<void(const Block& block)>& onBlock);
+
+    protected:
+        void HandleInterrupt() override;
+
+    private:
+        void Start();
+        void Restart();
+        void CheckHalf(bool alternate);
+        void Deliver(bool alternate);
+        void FlushFifo();
+        DmaChannel::Buffers Half(bool alternate);
+
+    private:
+        ADC0_Type& adc;
+        DmaChannel dmaChannel;
+        std::array<infra::MemoryRange<uint16_t>, 2> halves;
+        std::array<bool, 2> pending{};
+        bool nextAlternate = false;
+        bool streaming = false;
+        bool overrun = false;
+        infra::Function<void(Samples)> onSamples;
+        infra::Function<void(const Block& block)> onBlock;
+    };
+}
+
+#endif
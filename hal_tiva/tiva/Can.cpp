@@ -1,6 +1,7 @@
 #include "hal_tiva/tiva/Can.hpp"
 #include "infra/event/EventDispatcher.hpp"
 #include "infra/util/ReallyAssert.hpp"
+#include <algorithm>
 
 namespace
 {
@@ -112,7 +113,9 @@ namespace
         inline constexpr uint32_t RxIe = 1u << 10;
         inline constexpr uint32_t TxIe = 1u << 11;
         inline constexpr uint32_t UMask = 1u << 12;
+        inline constexpr uint32_t IntPnd = 1u << 13;
         inline constexpr uint32_t MsgLst = 1u << 14;
+        inline constexpr uint32_t NewDat = 1u << 15;
     }
 
     namespace ifmsk
@@ -146,8 +149,16 @@ namespace
     constexpr uint32_t maxPrescaler = 1024;
     constexpr uint32_t targetSamplePointPermille = 875;
 
-    constexpr uint8_t txMessageObject = 1;
-    constexpr uint8_t rxMessageObject = 2;
+    // Lower message objects win when several transmit requests are pending
+    constexpr uint8_t firstTxMessageObject = 1;
+
+    namespace arbitration
+    {
+        inline constexpr uint32_t IdeBit = 1u << 18;
+        inline constexpr uint32_t BaseIdShift = 19;
+        inline constexpr uint32_t ExtensionBits = 18;
+        inline constexpr uint32_t ExtensionMask = 0x3FFFF;
+    }
 
     std::optional<hal::tiva::Can::Error> LecToError(uint32_t lec)
     {
@@ -170,6 +181,21 @@ namespace
         }
     }
 
+    // Orders frames as the bus arbitration does: by base id first, where a standard
+    // frame beats an extended frame with the same base id, then by extended id
+    uint32_t ArbitrationPriority(hal::Can::Id id)
+    {
+        using namespace arbitration;
+
+        if (id.Is29BitId())
+        {
+            const uint32_t value = id.Get29BitId();
+            return ((value >> ExtensionBits) << BaseIdShift) | IdeBit | (value & ExtensionMask);
+        }
+
+        return (id.Get11BitId() & ifarb::Id11Mask) << BaseIdShift;
+    }
+
     void WaitWhileBusy(volatile uint32_t& crq)
     {
         while ((crq & ifcrq::Busy) != 0)
@@ -435,7 +461,7 @@ namespace
         can.IF2ARB2 = ifarb::MsgVal;
     }
 
-    void ConfigureReceiveMessageObject(CAN0_Type& can, const std::optional<hal::tiva::Can::Filter>& filter)
+    void ConfigureReceiveMessageObject(CAN0_Type& can, uint8_t messageObject, const std::optional<hal::tiva::Can::Filter>& filter, bool endOfBuffer)
     {
         WaitWhileBusy(can.IF2CRQ);
         can.IF2CMSK = ifcmsk::WrNRd | ifcmsk::Arb | ifcmsk::Control | ifcmsk::Mask;
@@ -445,11 +471,13 @@ namespace
         else
             ApplyAcceptAllFilter(can);
 
-        can.IF2MCTL = ifmctl::RxIe | ifmctl::Eob | ifmctl::UMask | (rxFilterDlc & ifmctl::DlcMask);
-        can.IF2CRQ = rxMessageObject;
+        can.IF2MCTL = ifmctl::RxIe | (endOfBuffer ? ifmctl::Eob : 0) | ifmctl::UMask | (rxFilterDlc & ifmctl::DlcMask);
+        can.IF2CRQ = messageObject;
     }
 
-    void LoadTxMessageObject(CAN0_Type& can, hal::Can::Id id, const hal::Can::Message& data)
+    // The IF1 interface registers are used from thread context, IF2 from the interrupt handler
+
+    void LoadTxMessageObject(CAN0_Type& can, uint8_t messageObject, hal::Can::Id id, const hal::Can::Message& data)
     {
         WaitWhileBusy(can.IF1CRQ);
 
@@ -457,7 +485,8 @@ namespace
 
         WriteArbitration(can.IF1ARB1, can.IF1ARB2, id, true);
 
-        can.IF1MCTL = ifmctl::TxRqst | ifmctl::TxIe | ifmctl::Eob | (data.size() & ifmctl::DlcMask);
+        // The controller clears NewDat once it copies the object for transmission
+        can.IF1MCTL = ifmctl::NewDat | ifmctl::TxRqst | ifmctl::TxIe | ifmctl::Eob | (data.size() & ifmctl::DlcMask);
 
         const auto packed = PackMessageData(data);
         can.IF1DA1 = packed.da1;
@@ -465,26 +494,78 @@ namespace
         can.IF1DB1 = packed.db1;
         can.IF1DB2 = packed.db2;
 
-        can.IF1CRQ = txMessageObject;
+        can.IF1CRQ = messageObject;
     }
 
-    void ClearMessageObjectInterrupt(CAN0_Type& can, uint32_t objectId)
+    // Invalidating the object withdraws its transmit request and pending interrupt
+    void AbortTxMessageObject(CAN0_Type& can, uint8_t messageObject)
+    {
+        WaitWhileBusy(can.IF1CRQ);
+        can.IF1CMSK = ifcmsk::WrNRd | ifcmsk::Arb | ifcmsk::Control;
+        can.IF1ARB1 = 0;
+        can.IF1ARB2 = 0;
+        can.IF1MCTL = 0;
+        can.IF1CRQ = messageObject;
+    }
+
+    // Invalidates the object first, so that the controller no longer picks it for
+    // transmission, and then checks whether it did so before. Returns false when
+    // the frame was already copied for transmission.
+    bool WithdrawTxMessageObject(CAN0_Type& can, uint8_t messageObject)
     {
         WaitWhileBusy(can.IF1CRQ);
-        can.IF1CMSK = ifcmsk::ClrIntPnd;
-        can.IF1CRQ = objectId & ifcrq::MnumMask;
+        can.IF1CMSK = ifcmsk::WrNRd | ifcmsk::Arb;
+        can.IF1ARB1 = 0;
+        can.IF1ARB2 = 0;
+        can.IF1CRQ = messageObject;
+
+        WaitWhileBusy(can.IF1CRQ);
+        can.IF1CMSK = ifcmsk::Control;
+        can.IF1CRQ = messageObject;
+        WaitWhileBusy(can.IF1CRQ);
+        const bool untouched = (can.IF1MCTL & ifmctl::NewDat) != 0;
+
+        can.IF1CMSK = ifcmsk::WrNRd | ifcmsk::Control;
+        can.IF1MCTL = 0;
+        can.IF1CRQ = messageObject;
+
+        return untouched;
+    }
+
+    void ClearMessageObjectInterrupt(CAN0_Type& can, uint32_t objectId)
+    {
+        WaitWhileBusy(can.IF2CRQ);
+        can.IF2CMSK = ifcmsk::ClrIntPnd;
+        can.IF2CRQ = objectId & ifcrq::MnumMask;
+    }
+
+    // Bit n - 1 is set when message object n holds a frame that has not been read
+    uint32_t NewDataObjects(CAN0_Type& can)
+    {
+        return (can.NWDA1 & 0xFFFF) | ((can.NWDA2 & 0xFFFF) << 16);
     }
 
-    RxReadResult ReadRxMessageObject(CAN0_Type& can)
+    // Clears MsgLst together with NewDat and IntPnd. Releasing NewDat first would let the
+    // controller store a frame in the object, which clearing MsgLst afterwards would wipe.
+    void ReleaseRxMessageObject(CAN0_Type& can, uint8_t messageObject, uint32_t mctl)
     {
         WaitWhileBusy(can.IF2CRQ);
-        can.IF2CMSK = ifcmsk::ClrIntPnd | ifcmsk::NewDat | ifcmsk::Arb | ifcmsk::Control | ifcmsk::DataA | ifcmsk::DataB;
-        can.IF2CRQ = rxMessageObject;
+        can.IF2CMSK = ifcmsk::WrNRd | ifcmsk::Control;
+        can.IF2MCTL = mctl & ~(ifmctl::MsgLst | ifmctl::NewDat | ifmctl::IntPnd);
+        can.IF2CRQ = messageObject;
+    }
+
+    RxReadResult ReadRxMessageObject(CAN0_Type& can, uint8_t messageObject)
+    {
+        WaitWhileBusy(can.IF2CRQ);
+        can.IF2CMSK = ifcmsk::Arb | ifcmsk::Control | ifcmsk::DataA | ifcmsk::DataB;
+        can.IF2CRQ = messageObject;
         WaitWhileBusy(can.IF2CRQ);
 
         RxReadResult result{};
-        result.messageLost = (can.IF2MCTL & ifmctl::MsgLst) != 0;
-        result.entry.length = can.IF2MCTL & ifmctl::DlcMask;
+        const uint32_t mctl = can.IF2MCTL;
+        result.messageLost = (mctl & ifmctl::MsgLst) != 0;
+        result.entry.length = mctl & ifmctl::DlcMask;
         result.entry.is29Bit = (can.IF2ARB2 & ifarb::Xtd) != 0;
         result.entry.id = result.entry.is29Bit
                               ? ((can.IF2ARB2 & ifarb::Id29HighMask) << ifarb::Id29HighShift) | can.IF2ARB1
@@ -492,6 +573,8 @@ namespace
 
         UnpackMessageData({ can.IF2DA1, can.IF2DA2, can.IF2DB1, can.IF2DB2 }, result.entry.length, result.entry.data);
 
+        ReleaseRxMessageObject(can, messageObject, mctl);
+
         return result;
     }
 }
@@ -511,8 +594,13 @@ namespace hal::tiva
         , rxPin(rxPin, PinConfigPeripheral::canRx)
         , txPin(txPin, PinConfigPeripheral::canTx)
         , config(config)
+        , firstRxMessageObject(firstTxMessageObject + config.txMessageObjects)
+        , lastRxMessageObject(firstRxMessageObject + config.rxMessageObjects - 1)
         , onError(onError)
     {
+        really_assert(config.txMessageObjects >= 1 && config.txMessageObjects <= maxTxMessageObjects);
+        really_assert(config.rxMessageObjects >= 1 && lastRxMessageObject <= totalMessageObjects);
+
         EnablePeripheralClock(canIndex);
 
         auto& can = Peripheral();
@@ -524,7 +612,9 @@ namespace hal::tiva
         DisableConfigurationAccess(can);
 
         ClearAllMessageObjects(can);
-        ConfigureReceiveMessageObject(can, this->config.filter);
+        // Frames are stored in the first free object of the chain, up to the object with EoB set
+        for (uint8_t object = firstRxMessageObject; object <= lastRxMessageObject; ++object)
+            ConfigureReceiveMessageObject(can, object, this->config.filter, object == lastRxMessageObject);
 
         (void)can.STS;
 
@@ -548,13 +638,16 @@ namespace hal::tiva
 
     void Can::SendData(Id id, const Message& data, const infra::Function<void(bool success)>& actionOnCompletion)
     {
-        really_assert(!sending.load(std::memory_order_acquire));
         really_assert(data.size() <= maxDataLength);
 
-        onSendComplete = actionOnCompletion;
-        sending.store(true, std::memory_order_release);
+        if (txQueue.size() >= maxQueuedTxFrames)
+        {
+            RejectTxFrame(actionOnCompletion);
+            return;
+        }
 
-        LoadTxMessageObject(Peripheral(), id, data);
+        QueueTxFrame(TxFrame{ ArbitrationPriority(id), id, data, actionOnCompletion }, false);
+        LoadTxMailboxes();
     }
 
     void Can::ReceiveData(const infra::Function<void(Id id, const Message& data)>& receivedAction)
@@ -562,6 +655,15 @@ namespace hal::tiva
         onReceive = receivedAction;
     }
 
+    Can::RxCounters Can::ReceiveCounters() const
+    {
+        RxCounters counters;
+        counters.received = rxReceived.load(std::memory_order_relaxed);
+        counters.overwritten = rxOverwritten.load(std::memory_order_relaxed);
+        counters.dropped = rxDropped.load(std::memory_order_relaxed);
+        return counters;
+    }
+
     CAN0_Type& Can::Peripheral() const
     {
         return *peripheralCan[canIndex];
@@ -580,10 +682,10 @@ namespace hal::tiva
 
             if (intStatus == interruptStatus::CauseStatus)
                 HandleStatusInterrupt();
-            else if (intStatus == txMessageObject)
-                HandleTxInterrupt();
-            else if (intStatus == rxMessageObject)
-                HandleRxInterrupt();
+            else if (intStatus >= firstTxMessageObject && intStatus < firstRxMessageObject)
+                HandleTxInterrupt(intStatus);
+            else if (intStatus >= firstRxMessageObject && intStatus <= lastRxMessageObject)
+                HandleRxInterrupt(intStatus);
             else
                 ClearMessageObjectInterrupt(can, intStatus);
         }
@@ -608,37 +710,65 @@ namespace hal::tiva
         if ((status & sts::BOff) != 0)
         {
             ScheduleError(Error::busOff);
-            NotifySendFailedFromInterrupt();
+            txAborted.store(true, std::memory_order_release);
+            ScheduleTxEvents();
 
             if (config.autoBusOffRecovery)
                 ExitInitMode(can);
         }
     }
 
-    void Can::HandleTxInterrupt()
+    void Can::HandleTxInterrupt(uint32_t messageObject)
     {
-        ClearMessageObjectInterrupt(Peripheral(), txMessageObject);
+        ClearMessageObjectInterrupt(Peripheral(), messageObject);
 
-        if (sending.exchange(false, std::memory_order_acq_rel))
-        {
-            infra::EventDispatcher::Instance().Schedule([this]()
-                {
-                    if (onSendComplete)
-                        onSendComplete(true);
-                });
-        }
+        txCompleted.fetch_or(1u << (messageObject - firstTxMessageObject), std::memory_order_acq_rel);
+        ScheduleTxEvents();
     }
 
-    void Can::HandleRxInterrupt()
+    void Can::HandleRxInterrupt(uint32_t messageObject)
     {
-        const auto result = ReadRxMessageObject(Peripheral());
+        auto& can = Peripheral();
+        const uint32_t chain = ((1u << (lastRxMessageObject - firstRxMessageObject + 1)) - 1) << (firstRxMessageObject - 1);
+        bool lost = false;
+        bool drained = false;
 
-        if (result.messageLost)
-            ScheduleError(Error::messageLost);
+        // Objects are read in chain order, which is the order in which they were filled.
+        // Frames arriving while the chain is drained are picked up by the next pass.
+        for (uint32_t pending = NewDataObjects(can) & chain; pending != 0; pending = NewDataObjects(can) & chain)
+        {
+            for (uint8_t object = firstRxMessageObject; object <= lastRxMessageObject; ++object)
+            {
+                if ((pending & (1u << (object - 1))) == 0)
+                    continue;
 
-        if (!rxQueue.Full())
-            rxQueue.AddFromInterrupt(result.entry);
-        else
+                const auto result = ReadRxMessageObject(can, object);
+                drained = true;
+                rxReceived.fetch_add(1, std::memory_order_relaxed);
+
+                if (result.messageLost)
+                {
+                    rxOverwritten.fetch_add(1, std::memory_order_relaxed);
+                    lost = true;
+                }
+
+                if (!rxQueue.Full())
+                {
+                    rxQueue.AddFromInterrupt(result.entry);
+                }
+                else
+                {
+                    rxDropped.fetch_add(1, std::memory_order_relaxed);
+                    lost = true;
+                }
+            }
+        }
+
+        // An interrupt without new data left would otherwise keep pending
+        if (!drained)
+            ClearMessageObjectInterrupt(can, messageObject);
+
+        if (lost)
             ScheduleError(Error::messageLost);
     }
 
@@ -668,15 +798,181 @@ namespace hal::tiva
             });
     }
 
-    void Can::NotifySendFailedFromInterrupt()
+    void Can::ScheduleTxEvents()
     {
-        if (sending.exchange(false, std::memory_order_acq_rel))
+        if (!txEventsScheduled.exchange(true, std::memory_order_acq_rel))
         {
             infra::EventDispatcher::Instance().Schedule([this]()
                 {
-                    if (onSendComplete)
-                        onSendComplete(false);
+                    ProcessTxEvents();
                 });
         }
     }
+
+    void Can::ProcessTxEvents()
+    {
+        txEventsScheduled.store(false, std::memory_order_release);
+
+        CollectTxCompletions();
+
+        if (txAborted.exchange(false, std::memory_order_acq_rel))
+        {
+            for (std::size_t i = 0; i != config.txMessageObjects; ++i)
+            {
+                auto& mailbox = txMailboxes[i];
+
+                if (mailbox.state != TxMailbox::State::loaded)
+                    continue;
+
+                AbortTxMessageObject(Peripheral(), firstTxMessageObject + i);
+                mailbox.state = TxMailbox::State::done;
+                mailbox.success = false;
+            }
+        }
+
+        // Mailboxes are refilled before their callbacks run, so that the bus is kept busy.
+        // Callbacks may send new frames, which never land in a mailbox that is still done.
+        for (auto& mailbox : txMailboxes)
+        {
+            if (mailbox.state != TxMailbox::State::done)
+                continue;
+
+            const auto onDone = mailbox.frame->onDone;
+            const auto success = mailbox.success;
+            mailbox.frame = std::nullopt;
+            mailbox.state = TxMailbox::State::free;
+
+            LoadTxMailboxes();
+
+            if (onDone)
+                onDone(success);
+        }
+
+        // Rejected frames are reported after the completions have made room. Frames that
+        // are rejected again from these callbacks are reported by the next pass.
+        const auto rejected = txRejected;
+        txRejected.clear();
+
+        for (const auto& onDone : rejected)
+        {
+            if (onDone)
+                onDone(false);
+        }
+    }
+
+    void Can::CollectTxCompletions()
+    {
+        const auto completed = txCompleted.exchange(0, std::memory_order_acq_rel);
+
+        for (std::size_t i = 0; i != config.txMessageObjects; ++i)
+        {
+            // A completion of a frame that was dropped by WithdrawOutrankedFrames may arrive after
+            // the mailbox is loaded again, while the new frame is still waiting for the bus
+            if ((completed & (1u << i)) != 0 && txMailboxes[i].state == TxMailbox::State::loaded && !TxRequestPending(i))
+            {
+                txMailboxes[i].state = TxMailbox::State::done;
+                txMailboxes[i].success = true;
+            }
+        }
+    }
+
+    // A frame that the controller already copied for transmission is never queued again,
+    // so that it is not sent twice. It is reported as sent; should that transmission fail,
+    // the controller does not retry it.
+    void Can::WithdrawOutrankedFrames(uint32_t priority)
+    {
+        // From the highest object down, so that withdrawn frames with the same id are
+        // queued again in their original order
+        for (std::size_t i = config.txMessageObjects; i-- != 0;)
+        {
+            auto& mailbox = txMailboxes[i];
+
+            if (mailbox.state != TxMailbox::State::loaded || mailbox.frame->priority <= priority || !TxRequestPending(i))
+                continue;
+
+            if (WithdrawTxMessageObject(Peripheral(), firstTxMessageObject + i))
+            {
+                QueueTxFrame(*mailbox.frame, true);
+                mailbox.frame = std::nullopt;
+                mailbox.state = TxMailbox::State::free;
+            }
+            else
+            {
+                mailbox.state = TxMailbox::State::done;
+                mailbox.success = true;
+                ScheduleTxEvents();
+            }
+        }
+    }
+
+    void Can::LoadTxMailboxes()
+    {
+        // Completions that are not yet processed would otherwise look like frames still waiting for the bus
+        CollectTxCompletions();
+
+        if (txQueue.empty())
+            return;
+
+        WithdrawOutrankedFrames(txQueue[0].priority);
+
+        // The remaining loaded frames outrank every queued frame, so queued frames go behind them
+        std::size_t next = 0;
+        for (std::size_t i = 0; i != config.txMessageObjects; ++i)
+            if (txMailboxes[i].state == TxMailbox::State::loaded && TxRequestPending(i))
+                next = i + 1;
+
+        for (; next != config.txMessageObjects && !txQueue.empty(); ++next)
+        {
+            auto& mailbox = txMailboxes[next];
+
+            if (mailbox.state != TxMailbox::State::free)
+                continue;
+
+            mailbox.frame.emplace(txQueue[0]);
+            mailbox.state = TxMailbox::State::loaded;
+            txQueue.erase(txQueue.begin());
+
+            LoadTxMessageObject(Peripheral(), firstTxMessageObject + next, mailbox.frame->id, mailbox.frame->data);
+        }
+    }
+
+    void Can::RejectTxFrame(const infra::Function<void(bool success)>& onDone)
+    {
+        // Only when the caller keeps sending without returning to the event dispatcher
+        if (txRejected.full())
+        {
+            if (onDone)
+                onDone(false);
+
+            return;
+        }
+
+        txRejected.push_back(onDone);
+        ScheduleTxEvents();
+    }
+
+    bool Can::TxRequestPending(std::size_t mailbox) const
+    {
+        auto& can = Peripheral();
+        const uint32_t object = firstTxMessageObject + mailbox;
+        const uint32_t pending = (can.TXRQ1 & 0xFFFF) | ((can.TXRQ2 & 0xFFFF) << 16);
+
+        return (pending & (1u << (object - 1))) != 0;
+    }
+
+    void Can::QueueTxFrame(const TxFrame& frame, bool aheadOfEqualPriority)
+    {
+        // Withdrawn frames go ahead of queued frames with the same id, new frames behind them
+        const auto position = aheadOfEqualPriority
+                                  ? std::lower_bound(txQueue.begin(), txQueue.end(), frame.priority, [](const TxFrame& queued, uint32_t priority)
+                                        {
+                                            return queued.priority < priority;
+                                        })
+                                  : std::upper_bound(txQueue.begin(), txQueue.end(), frame.priority, [](uint32_t priority, const TxFrame& queued)
+                                        {
+                                            return priority < queued.priority;
+                                        });
+
+        txQueue.insert(position, frame);
+    }
 }
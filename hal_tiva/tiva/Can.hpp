@@ -3,7 +3,9 @@
 #include "hal/interfaces/Can.hpp"
 #include "hal_tiva/cortex/InterruptCortex.hpp"
 #include "hal_tiva/tiva/Gpio.hpp"
+#include "infra/util/BoundedVector.hpp"
 #include "infra/event/QueueForOneReaderOneIrqWriter.hpp"
+#include <array>
 #include <atomic>
 #include <cstdint>
 #include <optional>
@@ -28,6 +30,9 @@ namespace hal::tiva
         template<std::size_t StorageSize>
         using WithMaxRxBuffer = infra::WithStorage<Can, std::array<CanRxEntry, StorageSize + 1>>;
 
+        static constexpr std::size_t maxTxMessageObjects = 16;
+        static constexpr std::size_t maxQueuedTxFrames = 16;
+
         enum class Error : uint8_t
         {
             stuffError,
@@ -69,25 +74,71 @@ namespace hal::tiva
             bool autoBusOffRecovery = true;
             std::variant<BitRate, BitTiming> timing = BitRate{ 1000000 };
             std::optional<Filter> filter;
+            uint8_t txMessageObjects = 4; // Frames loaded in the controller at once, at most maxTxMessageObjects
+            uint8_t rxMessageObjects = 8; // Chained into the receive FIFO of the controller
+        };
+
+        struct RxCounters
+        {
+            uint32_t received = 0;
+            uint32_t overwritten = 0; // Lost in the controller while its receive FIFO was full
+            uint32_t dropped = 0;     // Lost while the receive queue was full
         };
 
         Can(infra::MemoryRange<CanRxEntry> rxStorage, uint8_t canIndex, GpioPin& rxPin, GpioPin& txPin, const Config& config, const infra::Function<void(Error)>& onError);
         ~Can();
 
+        // Frames can be sent while others are in flight. The controller sends pending
+        // message objects in object order, so loaded frames are kept in objects ordered by
+        // arbitration priority: a frame that outranks loaded frames withdraws them, and
+        // they are loaded again behind it. Frames with the same id keep their order.
+        // When maxQueuedTxFrames frames are waiting, the frame is not sent and
+        // actionOnCompletion is called with false.
         void SendData(Id id, const Message& data, const infra::Function<void(bool success)>& actionOnCompletion) override;
         void ReceiveData(const infra::Function<void(Id id, const Message& data)>& receivedAction) override;
 
+        RxCounters ReceiveCounters() const;
+
     private:
+        struct TxFrame
+        {
+            uint32_t priority; // Arbitration order, lower values win
+            Id id;
+            Message data;
+            infra::Function<void(bool success)> onDone;
+        };
+
+        struct TxMailbox
+        {
+            enum class State : uint8_t
+            {
+                free,
+                loaded,
+                done, // Awaiting its completion callback
+            };
+
+            State state = State::free;
+            bool success = false;
+            std::optional<TxFrame> frame;
+        };
+
         CAN0_Type& Peripheral() const;
 
         void HandleInterrupt();
         void HandleStatusInterrupt();
-        void HandleTxInterrupt();
-        void HandleRxInterrupt();
+        void HandleTxInterrupt(uint32_t messageObject);
+        void HandleRxInterrupt(uint32_t messageObject);
 
         void ProcessRxBuffer();
         void ScheduleError(Error error) const;
-        void NotifySendFailedFromInterrupt();
+        void ScheduleTxEvents();
+        void ProcessTxEvents();
+        void CollectTxCompletions();
+        void WithdrawOutrankedFrames(uint32_t priority);
+        void LoadTxMailboxes();
+        bool TxRequestPending(std::size_t mailbox) const;
+        void QueueTxFrame(const TxFrame& frame, bool aheadOfEqualPriority);
+        void RejectTxFrame(const infra::Function<void(bool success)>& onDone);
 
     private:
         infra::QueueForOneReaderOneIrqWriter<CanRxEntry> rxQueue;
@@ -95,9 +146,20 @@ namespace hal::tiva
         PeripheralPin rxPin;
         PeripheralPin txPin;
         Config config;
-        infra::Function<void(bool success)> onSendComplete;
+        uint8_t firstRxMessageObject;
+        uint8_t lastRxMessageObject;
         infra::Function<void(Id id, const Message& data)> onReceive;
         infra::Function<void(Error)> onError;
-        std::atomic<bool> sending{ false };
+
+        std::array<TxMailbox, maxTxMessageObjects> txMailboxes;
+        infra::BoundedVector<TxFrame>::WithMaxSize<maxQueuedTxFrames + maxTxMessageObjects> txQueue; // Room for withdrawn frames
+        infra::BoundedVector<infra::Function<void(bool success)>>::WithMaxSize<maxQueuedTxFrames> txRejected;
+        std::atomic<uint32_t> txCompleted{ 0 };
+        std::atomic<bool> txAborted{ false };
+        std::atomic<bool> txEventsScheduled{ false };
+
+        std::atomic<uint32_t> rxReceived{ 0 };
+        std::atomic<uint32_t> rxOverwritten{ 0 };
+        std::atomic<uint32_t> rxDropped{ 0 };
     };
 }
@@ -0,0 +1,118 @@
+#include "hal_tiva/tiva/ControlLoop.hpp"
+#include "hal_tiva/cortex/DataWatchpointAndTrace.hpp"
+#include "infra/event/EventDispatcher.hpp"
+#include "infra/util/ReallyAssert.hpp"
+#include <algorithm>
+
+extern "C" uint32_t SystemCoreClock;
+
+namespace hal::tiva
+{
+    ControlLoop::ControlLoop(hal::AdcMultiChannel& adc, const Config& config)
+        : adc(adc)
+        , dwt(hal::DataWatchPointAndTrace::Instance())
+        , config(config)
+        , budgetCycles(SystemCoreClock / config.frequency)
+    {
+        really_assert(config.frequency > 0 && budgetCycles > 0);
+    }
+
+    ControlLoop::~ControlLoop()
+    {
+        Stop();
+    }
+
+    void ControlLoop::Start(const infra::Function<void(hal::AdcMultiChannel::Samples)>& step, const infra::Function<void(const Statistics&)>& onOverrun)
+    {
+        really_assert(!running);
+
+        this->step = step;
+        this->onOverrun = onOverrun;
+        stepPending = false;
+        running = true;
+
+        adc.Measure([this](hal::AdcMultiChannel::Samples samples)
+            {
+                Step(samples);
+            });
+    }
+
+    void ControlLoop::Stop()
+    {
+        if (!running)
+            return;
+
+        running = false;
+        adc.Stop();
+    }
+
+    void ControlLoop::PwmEvent(Pwm::NormalEvent event)
+    {
+        if (!running || event.generator != config.generator || event.source != config.source)
+            return;
+
+        if (stepPending)
+        {
+            ++statistics.missedPeriods;
+            ReportOverrun();
+        }
+
+        periodStart = dwt.CycleCount();
+        stepPending = true;
+    }
+
+    uint32_t ControlLoop::BudgetCycles() const
+    {
+        return budgetCycles;
+    }
+
+    ControlLoop::Statistics ControlLoop::CurrentStatistics() const
+    {
+        return statistics;
+    }
+
+    void ControlLoop::ResetStatistics()
+    {
+        statistics = Statistics();
+    }
+
+    void ControlLoop::Step(hal::AdcMultiChannel::Samples samples)
+    {
+        if (!running)
+            return;
+
+        auto start = dwt.CycleCount();
+        auto latency = stepPending ? start - periodStart : 0;
+        stepPending = false;
+
+        step(samples);
+
+        auto cycles = dwt.CycleCount() - start;
+
+        ++statistics.steps;
+        statistics.lastCycles = cycles;
+        statistics.maxCycles = std::max(statistics.maxCycles, cycles);
+        statistics.maxLatencyCycles = std::max(statistics.maxLatencyCycles, latency);
+
+        if (latency + cycles > budgetCycles)
+        {
+            ++statistics.overruns;
+            ReportOverrun();
+        }
+    }
+
+    void ControlLoop::ReportOverrun()
+    {
+        if (!onOverrun || reportScheduled)
+            return;
+
+        reportScheduled = true;
+        infra::EventDispatcher::Instance().Schedule([this]()
+            {
+                reportScheduled = false;
+
+                if (onOverrun)
+                    onOverrun(statistics);
+            });
+    }
+}
@@ -0,0 +1,69 @@
+#ifndef HAL_CONTROL_LOOP_TIVA_HPP
+#define HAL_CONTROL_LOOP_TIVA_HPP
+
+#include "hal/interfaces/AdcMultiChannel.hpp"
+#include "hal_tiva/cortex/DataWatchpointAndTrace.hpp"
+#include "hal_tiva/tiva/Pwm.hpp"
+#include "infra/util/Function.hpp"
+#include <cstdint>
+
+namespace hal::tiva
+{
+    // Runs one control step per PWM period. The period starts with a PWM generator
+    // event, which the owner of the Pwm forwards to PwmEvent, and the step runs in
+    // interrupt context as soon as the ADC, triggered by the same generator, completes
+    // its sequence. The step is timed against the period with the cycle counter of the
+    // DataWatchPointAndTrace instance, which has to exist before the loop is constructed.
+    class ControlLoop
+    {
+    public:
+        struct Config
+        {
+            Pwm::GeneratorIndex generator = Pwm::GeneratorIndex::generator0;
+            Pwm::NormalInterruptSource source = Pwm::NormalInterruptSource::countZero;
+            uint32_t frequency; // PWM periods per second
+        };
+
+        struct Statistics
+        {
+            uint32_t steps = 0;
+            uint32_t overruns = 0;         // Steps finished after the end of their period
+            uint32_t missedPeriods = 0;    // Periods that started before the previous step ran
+            uint32_t lastCycles = 0;       // Execution time of the last step
+            uint32_t maxCycles = 0;        // Longest execution time of a step
+            uint32_t maxLatencyCycles = 0; // Longest delay from the PWM event to the start of a step
+        };
+
+        ControlLoop(hal::AdcMultiChannel& adc, const Config& config);
+        ~ControlLoop();
+
+        // onOverrun is called from the event dispatcher, at most once until it has run
+        void Start(const infra::Function<void(hal::AdcMultiChannel::Samples)>& step, const infra::Function<void(const Statistics&)>& onOverrun = nullptr);
+        void Stop();
+
+        void PwmEvent(Pwm::NormalEvent event);
+
+        uint32_t BudgetCycles() const;
+        Statistics CurrentStatistics() const;
+        void ResetStatistics();
+
+    private:
+        void Step(hal::AdcMultiChannel::Samples samples);
+        void ReportOverrun();
+
+    private:
+        hal::AdcMultiChannel& adc;
+        const hal::DataWatchPointAndTrace& dwt;
+        Config config;
+        uint32_t budgetCycles;
+        infra::Function<void(hal::AdcMultiChannel::Samples)> step;
+        infra::Function<void(const Statistics&)> onOverrun;
+        volatile bool running = false;
+        volatile bool stepPending = false;
+        volatile bool reportScheduled = false;
+        uint32_t periodStart = 0;
+        Statistics statistics;
+    };
+}
+
+#endif
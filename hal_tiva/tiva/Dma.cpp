@@ -117,6 +117,13 @@ namespace hal::tiva
             UDMA->CTLBASE = address;
         }
 
+        void ChannelSelectPrimary(uint8_t channelNumber)
+        {
+            really_assert(channelNumber < 32);
+            auto mask = 1 << channelNumber;
+            UDMA->ALTCLR = mask;
+        }
+
         void ChannelRequest(uint8_t channelNumber)
         {
             really_assert(channelNumber < 32);
@@ -289,6 +296,12 @@ namespace hal::tiva
         ChannelAttributeDisable(channel.number, allAttributes);
     }
 
+    void DmaChannel::SetControlBlock(const ControlBlock& controlBlock) const
+    {
+        really_assert(!IsChannelEnabled(channel.number));
+        ChannelControlSet(channel.number, controlBlock);
+    }
+
     void DmaChannel::StartTransfer(Transfer transfer, const Buffers& buffer) const
     {
         really_assert(transfer != Transfer::pingPong);
@@ -300,6 +313,7 @@ namespace hal::tiva
     {
         ChannelSetTransfer(channel.number, ChannelType::primary, Transfer::pingPong, primaryBuffer.sourceAddress, primaryBuffer.destinationAddress, primaryBuffer.size);
         ChannelSetTransfer(channel.number, ChannelType::alternate, Transfer::pingPong, alternateBuffer.sourceAddress, alternateBuffer.destinationAddress, alternateBuffer.size);
+        ChannelSelectPrimary(channel.number);
         ChannelEnable(channel.number);
     }
 
@@ -319,6 +333,11 @@ namespace hal::tiva
         return ChannelGetMode(channel.number, ChannelType::alternate) == Transfer::stop;
     }
 
+    bool DmaChannel::IsTransferEnabled() const
+    {
+        return IsChannelEnabled(channel.number);
+    }
+
     void DmaChannel::StopTransfer() const
     {
         ChannelDisable(channel.number);
@@ -111,11 +111,13 @@ namespace hal::tiva
         DmaChannel(Dma& dma, const Channel& channel, const Configuration& configuration);
         ~DmaChannel();
 
+        void SetControlBlock(const ControlBlock& controlBlock) const;
         void StartTransfer(Transfer transfer, const Buffers& buffer) const;
         void StartPingPongTransfer(const Buffers& primaryBuffer, const Buffers& alternateBuffer) const;
         void ReArmPingPongHalf(bool alternate, const Buffers& buffer) const;
         bool IsPrimaryTransferCompleted() const;
         bool IsAlternateTransferCompleted() const;
+        bool IsTransferEnabled() const;
         void StopTransfer() const;
         std::size_t RemainingTransfers(bool alternate) const;
         void ForceRequest() const;
@@ -295,6 +295,16 @@ namespace hal::tiva
         Gpio::Instance().DisableInterrupt(port, index);
     }
 
+    void GpioPin::EnableAdcTrigger(InterruptTrigger trigger)
+    {
+        Gpio::Instance().EnableAdcTrigger(port, index, trigger);
+    }
+
+    void GpioPin::DisableAdcTrigger()
+    {
+        Gpio::Instance().DisableAdcTrigger(port, index);
+    }
+
     void GpioPin::ConfigAnalog()
     {
         Gpio::Instance().ReservePin(port, index);
@@ -381,6 +391,12 @@ namespace hal::tiva
     void DummyPin::ConfigPeripheral(PinConfigPeripheral pinConfigType)
     {}
 
+    void DummyPin::EnableAdcTrigger(InterruptTrigger trigger)
+    {}
+
+    void DummyPin::DisableAdcTrigger()
+    {}
+
     PeripheralPin::PeripheralPin(GpioPin& pin, PinConfigPeripheral pinConfigType)
         : pin(pin)
     {
@@ -571,6 +587,22 @@ namespace hal::tiva
         handlers[index] = nullptr;
     }
 
+    void Gpio::EnableAdcTrigger(Port port, uint8_t index, InterruptTrigger trigger)
+    {
+        infra::ReplaceBit(GpioTiva(port)->ADCCTL, false, index);
+
+        infra::ReplaceBit(GpioTiva(port)->IBE, interruptTiva[static_cast<uint8_t>(trigger)].ibe, index);
+        infra::ReplaceBit(GpioTiva(port)->IS, interruptTiva[static_cast<uint8_t>(trigger)].is, index);
+        infra::ReplaceBit(GpioTiva(port)->IEV, interruptTiva[static_cast<uint8_t>(trigger)].iev, index);
+
+        infra::ReplaceBit(GpioTiva(port)->ADCCTL, true, index);
+    }
+
+    void Gpio::DisableAdcTrigger(Port port, uint8_t index)
+    {
+        infra::ReplaceBit(GpioTiva(port)->ADCCTL, false, index);
+    }
+
     void Gpio::ExtiInterrupt(GPIOA_Type* gpio, std::size_t from, std::size_t to)
     {
         for (std::size_t line = from; line != to; ++line)
@@ -27,6 +27,8 @@ namespace hal::tiva
         spiMiso,
         spiMosi,
         spiSlaveSelect,
+        spiData2,
+        spiData3,
         usbFsId,
         usbFsDm,
         usbFsDp,
@@ -46,6 +48,8 @@ namespace hal::tiva
         ethernetLed1,
         ethernetLed2,
         comparatorOutput,
+        timerCapture0,
+        timerCapture1,
     };
 
     enum class Type : uint8_t
@@ -108,6 +112,8 @@ namespace hal::tiva
 
         virtual void ConfigAnalog();
         virtual void ConfigPeripheral(PinConfigPeripheral pinConfigType);
+        virtual void EnableAdcTrigger(InterruptTrigger trigger);
+        virtual void DisableAdcTrigger();
 
         uint32_t AdcChannel() const;
 
@@ -136,6 +142,8 @@ namespace hal::tiva
         void DisableInterrupt() override;
         void ConfigAnalog() override;
         void ConfigPeripheral(PinConfigPeripheral pinConfigType) override;
+        void EnableAdcTrigger(InterruptTrigger trigger) override;
+        void DisableAdcTrigger() override;
     };
 
     extern DummyPin dummyPin;
@@ -231,6 +239,8 @@ namespace hal::tiva
 
         void EnableInterrupt(Port port, uint8_t index, const infra::Function<void()>& action, InterruptTrigger trigger);
         void DisableInterrupt(Port port, uint8_t index);
+        void EnableAdcTrigger(Port port, uint8_t index, InterruptTrigger trigger);
+        void DisableAdcTrigger(Port port, uint8_t index);
 
         void ReservePin(Port port, uint8_t index);
         void ClearPinReservation(Port port, uint8_t index);
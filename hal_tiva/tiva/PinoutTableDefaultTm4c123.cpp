@@ -403,7 +403,51 @@ namespace hal::tiva
 
     constexpr infra::MemoryRange<const Gpio::PinoutTable> pinoutTableComparator = pinoutTableComparatorArray;
 
-    constexpr std::array<const infra::MemoryRange<const Gpio::PinoutTable>, 7> pinoutTableDefaultArray = { pinoutTableUart, pinoutTableSpi, pinoutTableI2c, pinoutTableCan, pinoutTablePwm, pinoutTableQei, pinoutTableComparator };
+    constexpr std::array<const Gpio::PinPosition, 9> pinoutTableTimerCapture0Pins = { {
+        { 0, Port::B, 6, 0x07 },
+        { 0, Port::F, 0, 0x07 },
+        { 1, Port::B, 4, 0x07 },
+        { 1, Port::F, 2, 0x07 },
+        { 2, Port::B, 0, 0x07 },
+        { 2, Port::F, 4, 0x07 },
+        { 3, Port::B, 2, 0x07 },
+        { 4, Port::C, 0, 0x07 },
+        { 5, Port::C, 2, 0x07 },
+    } };
+
+    constexpr std::array<const Gpio::PinPosition, 8> pinoutTableTimerCapture1Pins = { {
+        { 0, Port::B, 7, 0x07 },
+        { 0, Port::F, 1, 0x07 },
+        { 1, Port::B, 5, 0x07 },
+        { 1, Port::F, 3, 0x07 },
+        { 2, Port::B, 1, 0x07 },
+        { 3, Port::B, 3, 0x07 },
+        { 4, Port::C, 1, 0x07 },
+        { 5, Port::C, 3, 0x07 },
+    } };
+
+    constexpr std::array<const Gpio::PinoutTable, 2> pinoutTableTimerArray = { {
+        {
+            PinConfigPeripheral::timerCapture0,
+            pinoutTableTimerCapture0Pins,
+            Drive::None,
+            hal::PinConfigType::input,
+            Current::_2mA,
+            true,
+        },
+        {
+            PinConfigPeripheral::timerCapture1,
+            pinoutTableTimerCapture1Pins,
+            Drive::None,
+            hal::PinConfigType::input,
+            Current::_2mA,
+            true,
+        },
+    } };
+
+    constexpr infra::MemoryRange<const Gpio::PinoutTable> pinoutTableTimer = pinoutTableTimerArray;
+
+    constexpr std::array<const infra::MemoryRange<const Gpio::PinoutTable>, 8> pinoutTableDefaultArray = { pinoutTableUart, pinoutTableSpi, pinoutTableI2c, pinoutTableCan, pinoutTablePwm, pinoutTableQei, pinoutTableComparator, pinoutTableTimer };
     constexpr infra::MemoryRange<const infra::MemoryRange<const Gpio::PinoutTable>> pinoutTableDefault = pinoutTableDefaultArray;
     constexpr std::array<const Gpio::AnalogPinPosition, 12> analogTableDefaultArray = { {
         { Type::adc, Port::E, 3, 0 },
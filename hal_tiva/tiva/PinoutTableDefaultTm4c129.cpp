@@ -105,7 +105,16 @@ namespace hal::tiva
         { 3, Port::F, 2, 0x0e },
     } };
 
+    // XDAT1 receives and XDAT0 transmits in legacy mode
     constexpr std::array<const Gpio::PinPosition, 5> pinoutTableSpiRxPins = { {
+        { 0, Port::A, 5, 0x0f },
+        { 1, Port::E, 5, 0x0f },
+        { 2, Port::D, 0, 0x0f },
+        { 3, Port::Q, 3, 0x0e },
+        { 3, Port::F, 0, 0x0e },
+    } };
+
+    constexpr std::array<const Gpio::PinPosition, 5> pinoutTableSpiTxPins = { {
         { 0, Port::A, 4, 0x0f },
         { 1, Port::E, 4, 0x0f },
         { 2, Port::D, 1, 0x0f },
@@ -113,15 +122,23 @@ namespace hal::tiva
         { 3, Port::F, 1, 0x0e },
     } };
 
-    constexpr std::array<const Gpio::PinPosition, 5> pinoutTableSpiTxPins = { {
-        { 0, Port::A, 5, 0x0f },
-        { 1, Port::E, 5, 0x0f },
-        { 2, Port::D, 0, 0x0f },
-        { 3, Port::Q, 3, 0x0e },
-        { 3, Port::F, 0, 0x0e },
+    constexpr std::array<const Gpio::PinPosition, 5> pinoutTableSpiData2Pins = { {
+        { 0, Port::A, 6, 0x0d },
+        { 1, Port::D, 4, 0x0f },
+        { 2, Port::D, 7, 0x0f },
+        { 3, Port::P, 0, 0x0f },
+        { 3, Port::F, 4, 0x0e },
     } };
 
-    constexpr std::array<const Gpio::PinoutTable, 4> pinoutTableSpiArray = { {
+    constexpr std::array<const Gpio::PinPosition, 5> pinoutTableSpiData3Pins = { {
+        { 0, Port::A, 7, 0x0d },
+        { 1, Port::D, 5, 0x0f },
+        { 2, Port::D, 6, 0x0f },
+        { 3, Port::P, 1, 0x0f },
+        { 3, Port::F, 5, 0x0e },
+    } };
+
+    constexpr std::array<const Gpio::PinoutTable, 6> pinoutTableSpiArray = { {
         {
             PinConfigPeripheral::spiClock,
             pinoutTableSpiClkPins,
@@ -154,6 +171,22 @@ namespace hal::tiva
             Current::_2mA,
             true,
         },
+        {
+            PinConfigPeripheral::spiData2,
+            pinoutTableSpiData2Pins,
+            Drive::None,
+            hal::PinConfigType::output,
+            Current::_2mA,
+            true,
+        },
+        {
+            PinConfigPeripheral::spiData3,
+            pinoutTableSpiData3Pins,
+            Drive::None,
+            hal::PinConfigType::output,
+            Current::_2mA,
+            true,
+        },
     } };
 
     constexpr infra::MemoryRange<const Gpio::PinoutTable> pinoutTableSpi = pinoutTableSpiArray;
@@ -459,7 +492,66 @@ namespace hal::tiva
 
     constexpr infra::MemoryRange<const Gpio::PinoutTable> pinoutTableComparator = pinoutTableComparatorArray;
 
-    constexpr std::array<const infra::MemoryRange<const Gpio::PinoutTable>, 8> pinoutTableDefaultArray = { pinoutTableUart, pinoutTableSpi, pinoutTableI2c, pinoutTableCan, pinoutTablePwm, pinoutTableQei, pinoutTableEthernet, pinoutTableComparator };
+    constexpr std::array<const Gpio::PinPosition, 16> pinoutTableTimerCapture0Pins = { {
+        { 0, Port::A, 0, 0x03 },
+        { 0, Port::D, 0, 0x03 },
+        { 0, Port::L, 4, 0x03 },
+        { 1, Port::A, 2, 0x03 },
+        { 1, Port::D, 2, 0x03 },
+        { 1, Port::L, 6, 0x03 },
+        { 2, Port::A, 4, 0x03 },
+        { 2, Port::M, 0, 0x03 },
+        { 3, Port::A, 6, 0x03 },
+        { 3, Port::D, 4, 0x03 },
+        { 3, Port::M, 2, 0x03 },
+        { 4, Port::B, 0, 0x03 },
+        { 4, Port::D, 6, 0x03 },
+        { 4, Port::M, 4, 0x03 },
+        { 5, Port::B, 2, 0x03 },
+        { 5, Port::M, 6, 0x03 },
+    } };
+
+    constexpr std::array<const Gpio::PinPosition, 16> pinoutTableTimerCapture1Pins = { {
+        { 0, Port::A, 1, 0x03 },
+        { 0, Port::D, 1, 0x03 },
+        { 0, Port::L, 5, 0x03 },
+        { 1, Port::A, 3, 0x03 },
+        { 1, Port::D, 3, 0x03 },
+        { 1, Port::L, 7, 0x03 },
+        { 2, Port::A, 5, 0x03 },
+        { 2, Port::M, 1, 0x03 },
+        { 3, Port::A, 7, 0x03 },
+        { 3, Port::D, 5, 0x03 },
+        { 3, Port::M, 3, 0x03 },
+        { 4, Port::B, 1, 0x03 },
+        { 4, Port::D, 7, 0x03 },
+        { 4, Port::M, 5, 0x03 },
+        { 5, Port::B, 3, 0x03 },
+        { 5, Port::M, 7, 0x03 },
+    } };
+
+    constexpr std::array<const Gpio::PinoutTable, 2> pinoutTableTimerArray = { {
+        {
+            PinConfigPeripheral::timerCapture0,
+            pinoutTableTimerCapture0Pins,
+            Drive::None,
+            hal::PinConfigType::input,
+            Current::_2mA,
+            true,
+        },
+        {
+            PinConfigPeripheral::timerCapture1,
+            pinoutTableTimerCapture1Pins,
+            Drive::None,
+            hal::PinConfigType::input,
+            Current::_2mA,
+            true,
+        },
+    } };
+
+    constexpr infra::MemoryRange<const Gpio::PinoutTable> pinoutTableTimer = pinoutTableTimerArray;
+
+    constexpr std::array<const infra::MemoryRange<const Gpio::PinoutTable>, 9> pinoutTableDefaultArray = { pinoutTableUart, pinoutTableSpi, pinoutTableI2c, pinoutTableCan, pinoutTablePwm, pinoutTableQei, pinoutTableEthernet, pinoutTableComparator, pinoutTableTimer };
     constexpr infra::MemoryRange<const infra::MemoryRange<const Gpio::PinoutTable>> pinoutTableDefault = pinoutTableDefaultArray;
     constexpr std::array<const Gpio::AnalogPinPosition, 20> analogTableDefaultArray = { {
         { Type::adc, Port::E, 3, 0 },
@@ -17,6 +17,7 @@ namespace hal::tiva
     extern const infra::MemoryRange<const Gpio::PinoutTable> pinoutTablePwm;
     extern const infra::MemoryRange<const Gpio::PinoutTable> pinoutTableUsb;
     extern const infra::MemoryRange<const Gpio::PinoutTable> pinoutTableEthernet;
+    extern const infra::MemoryRange<const Gpio::PinoutTable> pinoutTableTimer;
 }
 
 #endif
@@ -3,6 +3,7 @@
 #include "hal/interfaces/Pwm.hpp"
 #include "hal_tiva/cortex/InterruptCortex.hpp"
 #include "hal_tiva/tiva/Gpio.hpp"
+#include "hal_tiva/tiva/PwmCore.hpp"
 #include "infra/util/BoundedVector.hpp"
 #include "infra/util/EnumCast.hpp"
 #include "infra/util/Function.hpp"
@@ -20,13 +21,8 @@ namespace hal::tiva
         , public hal::FourChannelsPwm
     {
     public:
-        enum class GeneratorIndex : uint8_t
-        {
-            generator0 = 0,
-            generator1 = 1,
-            generator2 = 2,
-            generator3 = 3,
-        };
+        using GeneratorIndex = PwmCore::GeneratorIndex;
+        using PinChannel = PwmCore::PinChannel;
 
         enum class NormalInterruptSource : uint8_t
         {
@@ -39,45 +35,8 @@ namespace hal::tiva
         };
 
         struct Config
+            : PwmCore::Config
         {
-            struct Control
-            {
-                enum class Mode
-                {
-                    edgeAligned = 0,
-                    centerAligned,
-                };
-
-                enum class UpdateMode
-                {
-                    locally = 2,
-                    globally = 3,
-                };
-
-                Mode mode = Mode::edgeAligned;
-                UpdateMode updateMode = UpdateMode::globally;
-                bool debugMode = false;
-
-                uint32_t Value() const;
-            };
-
-            struct DeadTime
-            {
-                uint16_t fallInClockCycles = 0xffff;
-                uint16_t riseInClockCycles = 0xffff;
-            };
-
-            enum class ClockDivisor
-            {
-                divisor1,
-                divisor2,
-                divisor4,
-                divisor8,
-                divisor16,
-                divisor32,
-                divisor64,
-            };
-
             struct InterruptConfig
             {
                 struct GeneratorInterrupt
@@ -86,51 +45,17 @@ namespace hal::tiva
                     NormalInterruptSource source;
                 };
 
-                struct FaultConfig
-                {
-                    GeneratorIndex generator;
-                    uint8_t enabledFaultInputs;
-                    uint8_t enabledComparatorInputs;
-                    bool latch;
-                    uint16_t minimumFaultPeriod;
-                };
+                using SafeState = PwmCore::SafeState;
+                using FaultConfig = PwmCore::FaultConfig;
 
                 infra::BoundedVector<GeneratorInterrupt>::WithMaxSize<4> normalSources;
                 infra::BoundedVector<FaultConfig>::WithMaxSize<4> faultConfigs;
                 InterruptPriority priority = InterruptPriority::Normal;
             };
 
-            bool channelAInverted = false;
-            bool channelBInverted = false;
-            Control control;
-            ClockDivisor clockDivisor = ClockDivisor::divisor64;
-            std::optional<DeadTime> deadTime;
             std::optional<InterruptConfig> interruptConfig;
         };
 
-        struct PinChannel
-        {
-            enum class Trigger
-            {
-                countZero,
-                countLoad,
-                countComparatorAUp,
-                countComparatorADown,
-                countComparatorBUp,
-                countComparatorBDown,
-            };
-
-            GeneratorIndex generator;
-
-            GpioPin& pinA = dummyPin;
-            GpioPin& pinB = dummyPin;
-
-            bool usesChannelA = false;
-            bool usesChannelB = false;
-
-            std::optional<Trigger> trigger;
-        };
-
         enum class FaultStatus : uint8_t
         {
             generator0 = 1 << 0,
@@ -172,6 +97,7 @@ namespace hal::tiva
             std::array<FaultInputComparator, 4> comparatorInputsByGenerator;
         };
 
+        // onFault is called from the event dispatcher, after the safe state has been applied by the hardware
         Pwm(uint8_t pwmIndex,
             infra::MemoryRange<PinChannel> channels,
             const Config& config,
@@ -180,59 +106,37 @@ namespace hal::tiva
         ~Pwm();
 
         void SetBaseFrequency(hal::Hertz baseFrequency) override;
+        // Switches to the divisor and load of the plan while the outputs keep running, and
+        // rescales the comparators so that the duty cycles are preserved. The divisor applies
+        // immediately and the rest on the next commit, so one period may be distorted. On
+        // TM4C123 the divisor is shared by both PWM modules.
+        void SetBaseFrequency(const PwmFrequencyPlan& plan);
         void Start(hal::Percent globalDutyCycle) override;
         void Start(hal::Percent dutyCycle1, hal::Percent dutyCycle2) override;
         void Start(hal::Percent dutyCycle1, hal::Percent dutyCycle2, hal::Percent dutyCycle3) override;
         void Start(hal::Percent dutyCycle1, hal::Percent dutyCycle2, hal::Percent dutyCycle3, hal::Percent dutyCycle4) override;
         void Stop() override;
 
-        static uint16_t CalculateDeadTimeCycles(std::chrono::nanoseconds deadTime, Config::ClockDivisor divisor);
+        // Releases latched faults; outputs return to the generators once the fault inputs are inactive
+        void ClearFaults();
 
-    private:
-        struct PwmChannelType
-        {
-            __IO uint32_t CTL;
-            __IO uint32_t INTEN;
-            __IO uint32_t RIS;
-            __IO uint32_t ISC;
-            __IO uint32_t LOAD;
-            __IO uint32_t COUNT;
-            __IO uint32_t CMPA;
-            __IO uint32_t CMPB;
-            __IO uint32_t GENA;
-            __IO uint32_t GENB;
-            __IO uint32_t DBCTL;
-            __IO uint32_t DBRISE;
-            __IO uint32_t DBFALL;
-            __IO uint32_t FLTSRC0;
-            __IO uint32_t FLTSRC1;
-            __IO uint32_t MINFLTPER;
-        };
-
-        static constexpr std::array<uint32_t, 4> peripheralPwmChannelOffsetArray = { {
-            0x00000040,
-            0x00000080,
-            0x000000C0,
-            0x00000100,
-        } };
-
-        static volatile PwmChannelType* const PwmChannel(uint32_t pwmBaseAddress, GeneratorIndex generatorIndex)
-        {
-            return reinterpret_cast<volatile PwmChannelType* const>(pwmBaseAddress + peripheralPwmChannelOffsetArray[infra::enum_cast(generatorIndex)]);
-        }
+        // Fast path for control loops: one value per generator, in the order of the channels
+        // given at construction. Only the comparators are written, so Start must have been
+        // called first to enable the generators and their outputs.
+        void SetCompareValues(infra::MemoryRange<const uint16_t> compareValues);
+        void SetDutyCycles(infra::MemoryRange<const uint16_t> dutyCyclesQ15); // 0x8000 is 100%
+        void StageLoad(uint16_t load);
+        uint16_t Load() const;
 
-        struct Generator
-        {
-            Generator(PinChannel& pins, uint32_t pwmOffset, GeneratorIndex index, std::optional<PinChannel::Trigger> trigger);
+        // With UpdateMode::globally, staged comparators and loads are held back until Commit,
+        // and are then applied by all generators at their next zero count. Counters are
+        // synchronized on Start, so that this happens in the same PWM period.
+        void Commit() const;
+        bool IsCommitPending() const;
 
-            std::optional<PeripheralPin> a;
-            std::optional<PeripheralPin> b;
-            volatile PwmChannelType* const address;
-            uint32_t enable = 0;
-            uint32_t generatorId = 0;
-            std::optional<PinChannel::Trigger> trigger;
-        };
+        static uint16_t CalculateDeadTimeCycles(std::chrono::nanoseconds deadTime, Config::ClockDivisor divisor);
 
+    private:
         struct GeneratorInterruptSlot
         {
             GeneratorInterruptSlot(Pwm& owner, IRQn_Type irq, hal::InterruptPriority priority, GeneratorIndex gen);
@@ -252,27 +156,17 @@ namespace hal::tiva
 
         uint8_t pwmIndex;
         const Config& config;
-        infra::BoundedVector<Generator>::WithMaxSize<4> generators;
+        PwmCore core;
         infra::Function<void(NormalEvent)> onNormalInterrupt;
         infra::Function<void(FaultEvent)> onFault;
         std::optional<GeneratorInterruptSlot> generatorHandlers[4];
         std::optional<FaultInterruptSlot> faultHandler;
+        volatile bool faultReportScheduled = false;
 
-        void Initialize();
         void ConfigureNormalInterrupts(const Config::InterruptConfig& interruptConfig);
         void ConfigureFaultInterrupts(const Config::InterruptConfig& interruptConfig);
-        void GeneratorConfiguration(Generator& generator) const;
-        void EnableDeadBand(Generator& generator) const;
-        void EnableGenerator(Generator& generator) const;
-        void DisableGenerator(Generator& generator) const;
-        void EnableOutput(const Generator& generator) const;
-        void DisableOutput(const Generator& generator) const;
-        void SetComparator(Generator& generator, const hal::Percent& dutyCycle) const;
-        void Sync() const;
-        uint32_t GetLoad(const Generator& generator) const;
-        void EnableClock() const;
-        void DisableClock() const;
         void HandleGeneratorIrq(GeneratorIndex gen);
         void HandleFaultIrq();
+        void ReportFault();
     };
 }
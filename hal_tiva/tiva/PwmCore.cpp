@@ -0,0 +1,562 @@
+#include "hal_tiva/tiva/PwmCore.hpp"
+#include "hal_tiva/tiva/PwmFrequencyPlanner.hpp"
+#include "infra/util/ReallyAssert.hpp"
+#include <algorithm>
+
+extern "C" uint32_t SystemCoreClock;
+
+namespace
+{
+#if defined(TM4C129)
+    constexpr std::size_t numberOfPwms = 1;
+#else
+    constexpr std::size_t numberOfPwms = 2;
+#endif
+
+    constexpr std::array<uint32_t, numberOfPwms> peripheralPwmArray = { {
+        PWM0_BASE,
+#if defined(TM4C123)
+        PWM1_BASE,
+#endif
+    } };
+
+    constexpr std::array<uint32_t, 4> peripheralPwmChannelOffsetArray = { {
+        0x00000040,
+        0x00000080,
+        0x000000C0,
+        0x00000100,
+    } };
+
+    constexpr const uint32_t PWM_ISC_INTFAULT3 = 0x00080000;
+    constexpr const uint32_t PWM_ISC_INTFAULT2 = 0x00040000;
+    constexpr const uint32_t PWM_ISC_INTFAULT1 = 0x00020000;
+    constexpr const uint32_t PWM_ISC_INTFAULT0 = 0x00010000;
+
+    constexpr const uint32_t PWM_CHANNEL_CTL_LATCH    = 0x00040000;
+    constexpr const uint32_t PWM_CHANNEL_CTL_MINFLTPER = 0x00020000;
+    constexpr const uint32_t PWM_CHANNEL_CTL_FLTSRC   = 0x00010000;
+    constexpr const uint32_t PWM_CHANNEL_CTL_ENABLE   = 0x00000001;
+
+    constexpr const uint32_t PWM_CHANNEL_INTEN_TRCMPBD  = 0x00002000;
+    constexpr const uint32_t PWM_CHANNEL_INTEN_TRCMPBU  = 0x00001000;
+    constexpr const uint32_t PWM_CHANNEL_INTEN_TRCMPAD  = 0x00000800;
+    constexpr const uint32_t PWM_CHANNEL_INTEN_TRCMPAU  = 0x00000400;
+    constexpr const uint32_t PWM_CHANNEL_INTEN_TRCNTLOAD = 0x00000200;
+    constexpr const uint32_t PWM_CHANNEL_INTEN_TRCNTZERO = 0x00000100;
+
+    constexpr const uint32_t PWM_CHANNEL_GENA_ACTCMPAU_ONE  = 0x00000030;
+    constexpr const uint32_t PWM_CHANNEL_GENA_ACTCMPAD_ZERO = 0x00000080;
+    constexpr const uint32_t PWM_CHANNEL_GENA_ACTLOAD_ONE   = 0x0000000C;
+
+    constexpr const uint32_t PWM_CHANNEL_GENB_ACTCMPBU_ONE  = 0x00000300;
+    constexpr const uint32_t PWM_CHANNEL_GENB_ACTCMPBD_ZERO = 0x00000800;
+    constexpr const uint32_t PWM_CHANNEL_GENB_ACTLOAD_ONE   = 0x0000000C;
+
+    constexpr const uint32_t PWM_CHANNEL_DBCTL_ENABLE = 0x00000001;
+
+    constexpr const uint32_t SYSCTL_RCC_USEPWMDIV = 0x00100000;
+    constexpr const uint32_t SYSCTL_RCC_PWMDIV_M  = 0x000E0000;
+    constexpr const uint32_t SYSCTL_RCC_PWMDIV_2  = 0x00000000;
+    constexpr const uint32_t SYSCTL_RCC_PWMDIV_4  = 0x00020000;
+    constexpr const uint32_t SYSCTL_RCC_PWMDIV_8  = 0x00040000;
+    constexpr const uint32_t SYSCTL_RCC_PWMDIV_16 = 0x00060000;
+    constexpr const uint32_t SYSCTL_RCC_PWMDIV_32 = 0x00080000;
+    constexpr const uint32_t SYSCTL_RCC_PWMDIV_64 = 0x000A0000;
+
+    constexpr const uint32_t PWM_CC_USEPWMDIV = 0x00000100;
+    constexpr const uint32_t PWM_CC_PWMDIV_M  = 0x00000007;
+    constexpr const uint32_t PWM_CC_PWMDIV_2  = 0x00000000;
+    constexpr const uint32_t PWM_CC_PWMDIV_4  = 0x00000001;
+    constexpr const uint32_t PWM_CC_PWMDIV_8  = 0x00000002;
+    constexpr const uint32_t PWM_CC_PWMDIV_16 = 0x00000003;
+    constexpr const uint32_t PWM_CC_PWMDIV_32 = 0x00000004;
+    constexpr const uint32_t PWM_CC_PWMDIV_64 = 0x00000005;
+
+    constexpr const uint32_t SYSCTL_DC1_PWM1 = 0x00200000;
+    constexpr const uint32_t SYSCTL_DC1_PWM0 = 0x00100000;
+
+    constexpr const std::size_t faultStatusStride = 0x80 / sizeof(uint32_t);
+
+    constexpr const uint32_t maxDeadBandCycles = 4095;
+
+    constexpr const std::array<uint32_t, 6> triggerType = { {
+        PWM_CHANNEL_INTEN_TRCNTZERO,
+        PWM_CHANNEL_INTEN_TRCNTLOAD,
+        PWM_CHANNEL_INTEN_TRCMPAU,
+        PWM_CHANNEL_INTEN_TRCMPAD,
+        PWM_CHANNEL_INTEN_TRCMPBU,
+        PWM_CHANNEL_INTEN_TRCMPBD,
+    } };
+
+    constexpr const std::array<uint32_t, 7> clockDivisor = { {
+#if defined(TM4C123)
+        0,
+        SYSCTL_RCC_PWMDIV_2  | SYSCTL_RCC_USEPWMDIV,
+        SYSCTL_RCC_PWMDIV_4  | SYSCTL_RCC_USEPWMDIV,
+        SYSCTL_RCC_PWMDIV_8  | SYSCTL_RCC_USEPWMDIV,
+        SYSCTL_RCC_PWMDIV_16 | SYSCTL_RCC_USEPWMDIV,
+        SYSCTL_RCC_PWMDIV_32 | SYSCTL_RCC_USEPWMDIV,
+        SYSCTL_RCC_PWMDIV_64 | SYSCTL_RCC_USEPWMDIV,
+#else
+        0,
+        PWM_CC_PWMDIV_2  | PWM_CC_USEPWMDIV,
+        PWM_CC_PWMDIV_4  | PWM_CC_USEPWMDIV,
+        PWM_CC_PWMDIV_8  | PWM_CC_USEPWMDIV,
+        PWM_CC_PWMDIV_16 | PWM_CC_USEPWMDIV,
+        PWM_CC_PWMDIV_32 | PWM_CC_USEPWMDIV,
+        PWM_CC_PWMDIV_64 | PWM_CC_USEPWMDIV,
+#endif
+    } };
+
+    // Generator n drives outputs 2n (A) and 2n + 1 (B)
+    constexpr uint8_t OutputIndex(hal::tiva::PwmCore::GeneratorIndex generator, bool channelB)
+    {
+        return static_cast<uint8_t>(infra::enum_cast(generator) * 2 + (channelB ? 1 : 0));
+    }
+
+    constexpr hal::tiva::PinConfigPeripheral OutputPeripheral(hal::tiva::PwmCore::GeneratorIndex generator, bool channelB)
+    {
+        return static_cast<hal::tiva::PinConfigPeripheral>(infra::enum_cast(hal::tiva::PinConfigPeripheral::pwmChannel0) + OutputIndex(generator, channelB));
+    }
+
+    static_assert(OutputPeripheral(hal::tiva::PwmCore::GeneratorIndex::generator0, false) == hal::tiva::PinConfigPeripheral::pwmChannel0);
+    static_assert(OutputPeripheral(hal::tiva::PwmCore::GeneratorIndex::generator1, true) == hal::tiva::PinConfigPeripheral::pwmChannel3);
+    static_assert(OutputPeripheral(hal::tiva::PwmCore::GeneratorIndex::generator2, false) == hal::tiva::PinConfigPeripheral::pwmChannel4);
+    static_assert(OutputPeripheral(hal::tiva::PwmCore::GeneratorIndex::generator3, true) == hal::tiva::PinConfigPeripheral::pwmChannel7);
+
+    void SetClockDivisor(PWM0_Type& pwm, hal::tiva::PwmCore::Config::ClockDivisor divisor)
+    {
+#if defined(TM4C123)
+        really_assert(SYSCTL->DC1 & (SYSCTL_DC1_PWM0 | SYSCTL_DC1_PWM1));
+        SYSCTL->RCC = ((SYSCTL->RCC & ~(SYSCTL_RCC_USEPWMDIV | SYSCTL_RCC_PWMDIV_M)) | clockDivisor[static_cast<std::size_t>(divisor)]);
+#else
+        pwm.CC = ((pwm.CC & ~(PWM_CC_USEPWMDIV | PWM_CC_PWMDIV_M)) | clockDivisor[static_cast<std::size_t>(divisor)]);
+#endif
+    }
+
+    uint32_t GetClockDivisor(const PWM0_Type& pwm)
+    {
+#if defined(TM4C123)
+        auto result = (SYSCTL->RCC & SYSCTL_RCC_PWMDIV_M) >> 17;
+        if (!(SYSCTL->RCC & SYSCTL_RCC_USEPWMDIV))
+            return 1;
+        else
+            return 1U << (result + 1);
+#else
+        auto result = pwm.CC & PWM_CC_PWMDIV_M;
+        if (!(pwm.CC & PWM_CC_USEPWMDIV))
+            return 1;
+        else
+            return 1U << (result + 1);
+#endif
+    }
+
+    uint32_t DivisorValue(hal::tiva::PwmCore::Config::ClockDivisor divisor)
+    {
+        return 1u << static_cast<uint32_t>(divisor);
+    }
+
+    // On TM4C123 the divisor is in RCC, and clocks both PWM modules
+    bool ClockDivisorShared(uint8_t pwmIndex)
+    {
+#if defined(TM4C123)
+        return (SYSCTL->RCGCPWM & (1 << (pwmIndex ^ 1))) != 0;
+#else
+        return false;
+#endif
+    }
+
+    float GetSystemCoreClock()
+    {
+        return static_cast<float>(SystemCoreClock);
+    }
+
+    uint32_t ToPeriod(const PWM0_Type& pwm, const hal::Hertz& baseFrequency)
+    {
+        auto pwmClock = SystemCoreClock / GetClockDivisor(pwm);
+        return pwmClock / baseFrequency.Value();
+    }
+
+    // FLTSTAT registers are write one to clear when the fault is latched
+    volatile uint32_t& FaultStatus0(PWM0_Type& pwm, uint8_t generator)
+    {
+        return *(const_cast<volatile uint32_t*>(&pwm._0_FLTSTAT0) + generator * faultStatusStride);
+    }
+
+    volatile uint32_t& FaultStatus1(PWM0_Type& pwm, uint8_t generator)
+    {
+        return *(const_cast<volatile uint32_t*>(&pwm._0_FLTSTAT1) + generator * faultStatusStride);
+    }
+}
+
+namespace hal::tiva
+{
+    uint32_t PwmCore::Config::Control::Value() const
+    {
+        auto value = static_cast<uint32_t>(mode) << 1;
+
+        value |= static_cast<uint32_t>(debugMode) << 2;
+
+        value |= static_cast<uint32_t>(updateMode == UpdateMode::globally) << 3;
+        value |= static_cast<uint32_t>(updateMode == UpdateMode::globally) << 4;
+        value |= static_cast<uint32_t>(updateMode == UpdateMode::globally) << 5;
+
+        value |= static_cast<uint32_t>(updateMode) << 6;
+        value |= static_cast<uint32_t>(updateMode) << 8;
+
+        return value & 0x7fffe;
+    }
+
+    PwmCore::Generator::Generator(PinChannel& pins, volatile PwmChannelType* address)
+        : address(address)
+        , generatorId(1 << infra::enum_cast(pins.generator))
+        , trigger(pins.trigger)
+    {
+        if (pins.usesChannelA)
+        {
+            a.emplace(pins.pinA, OutputPeripheral(pins.generator, false));
+            enable |= 1 << OutputIndex(pins.generator, false);
+        }
+
+        if (pins.usesChannelB)
+        {
+            b.emplace(pins.pinB, OutputPeripheral(pins.generator, true));
+            enable |= 1 << OutputIndex(pins.generator, true);
+        }
+    }
+
+    PwmCore::PwmCore(uint8_t pwmIndex, infra::MemoryRange<PinChannel> channels, const Config& config)
+        : pwmIndex(pwmIndex)
+        , config(config)
+    {
+        really_assert(pwmIndex < numberOfPwms);
+        really_assert(!channels.empty() && channels.size() <= generators.max_size());
+
+        for (auto& channel : channels)
+        {
+            really_assert(infra::enum_cast(channel.generator) < peripheralPwmChannelOffsetArray.size());
+            // Every generator can only be claimed once
+            really_assert((generatorMask & (1 << infra::enum_cast(channel.generator))) == 0);
+
+            generators.emplace_back(channel, Channel(channel.generator));
+            generatorMask |= generators.back().generatorId;
+        }
+
+        EnableClock();
+        SetClockDivisor(Peripheral(), config.clockDivisor);
+
+        for (auto& generator : generators)
+            GeneratorConfiguration(generator);
+    }
+
+    PwmCore::~PwmCore()
+    {
+        Stop();
+        DisableClock();
+    }
+
+    PWM0_Type& PwmCore::Peripheral() const
+    {
+        return *reinterpret_cast<PWM0_Type*>(peripheralPwmArray[pwmIndex]);
+    }
+
+    volatile PwmCore::PwmChannelType* PwmCore::Channel(GeneratorIndex generator) const
+    {
+        return reinterpret_cast<volatile PwmChannelType*>(peripheralPwmArray[pwmIndex] + peripheralPwmChannelOffsetArray[infra::enum_cast(generator)]);
+    }
+
+    void PwmCore::SetBaseFrequency(hal::Hertz baseFrequency)
+    {
+        auto load = ToPeriod(Peripheral(), baseFrequency);
+        load = IsCenterAligned() ? load / 2 : load - 1;
+        really_assert(load > 0 && load <= 0xffff);
+
+        StageLoad(static_cast<uint16_t>(load));
+        Commit();
+    }
+
+    void PwmCore::SetBaseFrequency(const PwmFrequencyPlan& plan)
+    {
+        really_assert(plan.mode == config.control.mode);
+
+        for (auto& generator : generators)
+            if (generator.load != 0)
+            {
+                auto compareValue = generator.a ? generator.address->CMPA : generator.address->CMPB;
+                auto width = (generator.load - compareValue) * plan.load / generator.load;
+
+                WriteComparator(generator, plan.load - width);
+            }
+
+        auto currentDivisor = GetClockDivisor(Peripheral());
+        auto newDivisor = DivisorValue(plan.divisor);
+
+        if (newDivisor != currentDivisor)
+        {
+            really_assert(!ClockDivisorShared(pwmIndex));
+
+            // The dead band is counted in PWM clocks and applies at once, like the divisor.
+            // Ordering the two keeps the dead time at least as long as configured.
+            if (newDivisor < currentDivisor)
+            {
+                RescaleDeadBand(currentDivisor, newDivisor);
+                SetClockDivisor(Peripheral(), plan.divisor);
+            }
+            else
+            {
+                SetClockDivisor(Peripheral(), plan.divisor);
+                RescaleDeadBand(currentDivisor, newDivisor);
+            }
+        }
+
+        StageLoad(plan.load);
+        Commit();
+    }
+
+    void PwmCore::Start(hal::Percent dutyCycle)
+    {
+        for (auto& generator : generators)
+            SetComparator(generator, dutyCycle);
+
+        Run();
+    }
+
+    void PwmCore::Start(std::initializer_list<hal::Percent> dutyCycles)
+    {
+        really_assert(dutyCycles.size() == generators.size());
+
+        auto generator = generators.begin();
+        for (auto& dutyCycle : dutyCycles)
+            SetComparator(*generator++, dutyCycle);
+
+        Run();
+    }
+
+    void PwmCore::Stop()
+    {
+        for (auto& generator : generators)
+        {
+            generator.address->CTL &= ~PWM_CHANNEL_CTL_ENABLE;
+            Peripheral().ENABLE &= ~generator.enable;
+        }
+
+        running = false;
+        Commit();
+    }
+
+    void PwmCore::SetCompareValues(infra::MemoryRange<const uint16_t> compareValues)
+    {
+        really_assert(compareValues.size() == generators.size());
+
+        for (std::size_t i = 0; i != generators.size(); ++i)
+            WriteComparator(generators[i], std::min<uint32_t>(compareValues[i], generators[i].load));
+    }
+
+    void PwmCore::SetDutyCycles(infra::MemoryRange<const uint16_t> dutyCyclesQ15)
+    {
+        really_assert(dutyCyclesQ15.size() == generators.size());
+
+        for (std::size_t i = 0; i != generators.size(); ++i)
+        {
+            const auto& generator = generators[i];
+            auto width = std::min((generator.span * dutyCyclesQ15[i]) >> 15, generator.load);
+
+            WriteComparator(generator, generator.load - width);
+        }
+    }
+
+    void PwmCore::StageLoad(uint16_t load)
+    {
+        really_assert(load > 0);
+
+        for (auto& generator : generators)
+            if (generator.a || generator.b)
+            {
+                generator.address->LOAD = load;
+                generator.load = load;
+                generator.span = IsCenterAligned() ? load : load + 1u;
+            }
+    }
+
+    uint16_t PwmCore::Load() const
+    {
+        return static_cast<uint16_t>(generators[0].load);
+    }
+
+    void PwmCore::Commit() const
+    {
+        Peripheral().CTL = generatorMask;
+    }
+
+    bool PwmCore::IsCommitPending() const
+    {
+        return (Peripheral().CTL & generatorMask) != 0;
+    }
+
+    void PwmCore::ConfigureFault(const FaultConfig& faultConfig)
+    {
+        auto generator = infra::enum_cast(faultConfig.generator);
+        really_assert(generator < peripheralPwmChannelOffsetArray.size());
+
+        auto* channel = Channel(faultConfig.generator);
+        channel->FLTSRC0 = faultConfig.enabledFaultInputs & 0x0F;
+        channel->FLTSRC1 = faultConfig.enabledComparatorInputs & 0xFF;
+
+        if (faultConfig.minimumFaultPeriod > 0)
+        {
+            channel->MINFLTPER = faultConfig.minimumFaultPeriod;
+            channel->CTL |= PWM_CHANNEL_CTL_MINFLTPER;
+        }
+
+        if (faultConfig.safeState)
+        {
+            auto outputs = (1u << OutputIndex(faultConfig.generator, false)) | (1u << OutputIndex(faultConfig.generator, true));
+            auto levels = (static_cast<uint32_t>(faultConfig.safeState->levelA) << OutputIndex(faultConfig.generator, false)) | (static_cast<uint32_t>(faultConfig.safeState->levelB) << OutputIndex(faultConfig.generator, true));
+
+            Peripheral().FAULTVAL = (Peripheral().FAULTVAL & ~outputs) | levels;
+            Peripheral().FAULT |= outputs;
+        }
+
+        auto ctlFaultBits = PWM_CHANNEL_CTL_FLTSRC;
+        if (faultConfig.latch)
+            ctlFaultBits |= PWM_CHANNEL_CTL_LATCH;
+        channel->CTL |= ctlFaultBits;
+    }
+
+    void PwmCore::ClearFaults()
+    {
+        for (uint8_t generator = 0; generator != peripheralPwmChannelOffsetArray.size(); ++generator)
+        {
+            FaultStatus0(Peripheral(), generator) = 0x0F;
+            FaultStatus1(Peripheral(), generator) = 0xFF;
+        }
+
+        Peripheral().ISC = PWM_ISC_INTFAULT3 | PWM_ISC_INTFAULT2 | PWM_ISC_INTFAULT1 | PWM_ISC_INTFAULT0;
+    }
+
+    uint8_t PwmCore::FaultedGenerators() const
+    {
+        return static_cast<uint8_t>(Peripheral().STATUS & 0x0F);
+    }
+
+    uint8_t PwmCore::FaultInputs(GeneratorIndex generator) const
+    {
+        return static_cast<uint8_t>(FaultStatus0(Peripheral(), infra::enum_cast(generator)) & 0x0F);
+    }
+
+    uint8_t PwmCore::FaultComparatorInputs(GeneratorIndex generator) const
+    {
+        return static_cast<uint8_t>(FaultStatus1(Peripheral(), infra::enum_cast(generator)) & 0xFF);
+    }
+
+    uint16_t PwmCore::CalculateDeadTimeCycles(std::chrono::nanoseconds deadTime, Config::ClockDivisor divisor)
+    {
+        static constexpr std::array<uint32_t, 7> divisorValues = { { 1, 2, 4, 8, 16, 32, 64 } };
+
+        auto divisorValue = divisorValues[static_cast<uint32_t>(divisor)];
+        auto pwmClockFreq = GetSystemCoreClock() / static_cast<float>(divisorValue);
+        auto deadTimeNs = static_cast<float>(deadTime.count());
+        auto cycles = static_cast<uint32_t>(deadTimeNs * pwmClockFreq / 1e9);
+
+        really_assert(cycles <= maxDeadBandCycles);
+
+        return static_cast<uint16_t>(cycles);
+    }
+
+    void PwmCore::GeneratorConfiguration(Generator& generator) const
+    {
+        if (generator.a || generator.b)
+        {
+            generator.address->CTL |= config.control.Value();
+            generator.address->GENA = IsCenterAligned()
+                ? (PWM_CHANNEL_GENA_ACTCMPAU_ONE | PWM_CHANNEL_GENA_ACTCMPAD_ZERO)
+                : (PWM_CHANNEL_GENA_ACTLOAD_ONE  | PWM_CHANNEL_GENA_ACTCMPAD_ZERO);
+            generator.address->GENB = IsCenterAligned()
+                ? (PWM_CHANNEL_GENB_ACTCMPBU_ONE | PWM_CHANNEL_GENB_ACTCMPBD_ZERO)
+                : (PWM_CHANNEL_GENB_ACTLOAD_ONE  | PWM_CHANNEL_GENB_ACTCMPBD_ZERO);
+
+            if (generator.trigger)
+                generator.address->INTEN |= triggerType[static_cast<uint32_t>(*generator.trigger)];
+
+            if (config.deadTime)
+                EnableDeadBand(generator);
+            else
+                generator.address->DBCTL &= ~PWM_CHANNEL_DBCTL_ENABLE;
+        }
+    }
+
+    void PwmCore::EnableDeadBand(Generator& generator) const
+    {
+        generator.address->DBFALL = config.deadTime->fallInClockCycles;
+        generator.address->DBRISE = config.deadTime->riseInClockCycles;
+        generator.address->DBCTL |= PWM_CHANNEL_DBCTL_ENABLE;
+    }
+
+    void PwmCore::RescaleDeadBand(uint32_t fromDivisor, uint32_t toDivisor) const
+    {
+        // Rounded up, so that the dead time does not shrink
+        const auto rescale = [fromDivisor, toDivisor](uint32_t cycles)
+        {
+            auto rescaled = (cycles * fromDivisor + toDivisor - 1) / toDivisor;
+            really_assert(rescaled <= maxDeadBandCycles);
+            return rescaled;
+        };
+
+        for (auto& generator : generators)
+            if ((generator.address->DBCTL & PWM_CHANNEL_DBCTL_ENABLE) != 0)
+            {
+                generator.address->DBFALL = rescale(generator.address->DBFALL);
+                generator.address->DBRISE = rescale(generator.address->DBRISE);
+            }
+    }
+
+    void PwmCore::SetComparator(Generator& generator, const hal::Percent& dutyCycle) const
+    {
+        really_assert(dutyCycle.Value() <= 100);
+
+        auto width = std::min(generator.span * dutyCycle.Value() / 100, generator.load);
+
+        WriteComparator(generator, generator.load - width);
+
+        Peripheral().ENABLE |= generator.enable;
+        generator.address->CTL |= PWM_CHANNEL_CTL_ENABLE;
+    }
+
+    void PwmCore::WriteComparator(const Generator& generator, uint32_t compareValue) const
+    {
+        if (generator.a)
+            generator.address->CMPA = compareValue;
+        if (generator.b)
+            generator.address->CMPB = compareValue;
+    }
+
+    void PwmCore::Run()
+    {
+        if (!running)
+        {
+            Peripheral().SYNC = generatorMask;
+            running = true;
+        }
+
+        Commit();
+    }
+
+    bool PwmCore::IsCenterAligned() const
+    {
+        return config.control.mode == Config::Control::Mode::centerAligned;
+    }
+
+    void PwmCore::EnableClock() const
+    {
+        SYSCTL->RCGCPWM |= (1 << pwmIndex);
+
+        while (!(SYSCTL->PRPWM & (1 << pwmIndex)))
+        {
+        }
+    }
+
+    void PwmCore::DisableClock() const
+    {
+        SYSCTL->RCGCPWM &= ~(1 << pwmIndex);
+    }
+}
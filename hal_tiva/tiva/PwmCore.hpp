@@ -0,0 +1,210 @@
+#ifndef HAL_PWM_CORE_TIVA_HPP
+#define HAL_PWM_CORE_TIVA_HPP
+
+#include "hal/interfaces/Pwm.hpp"
+#include "hal_tiva/tiva/Gpio.hpp"
+#include "infra/util/BoundedVector.hpp"
+#include "infra/util/EnumCast.hpp"
+#include "infra/util/MemoryRange.hpp"
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+#include DEVICE_HEADER
+
+namespace hal::tiva
+{
+    struct PwmFrequencyPlan;
+
+    // The generators of one PWM module as used by Pwm and SynchronousPwm: clocking,
+    // generator configuration, duty cycle updates, the global update commit and the
+    // hardware fault response. Interrupts are left to the drivers.
+    class PwmCore
+    {
+    public:
+        enum class GeneratorIndex : uint8_t
+        {
+            generator0 = 0,
+            generator1 = 1,
+            generator2 = 2,
+            generator3 = 3,
+        };
+
+        struct Config
+        {
+            struct Control
+            {
+                enum class Mode
+                {
+                    edgeAligned = 0,
+                    centerAligned,
+                };
+
+                enum class UpdateMode
+                {
+                    locally = 2,
+                    globally = 3,
+                };
+
+                Mode mode = Mode::edgeAligned;
+                UpdateMode updateMode = UpdateMode::globally;
+                bool debugMode = false;
+
+                uint32_t Value() const;
+            };
+
+            struct DeadTime
+            {
+                uint16_t fallInClockCycles = 0xffff;
+                uint16_t riseInClockCycles = 0xffff;
+            };
+
+            enum class ClockDivisor
+            {
+                divisor1,
+                divisor2,
+                divisor4,
+                divisor8,
+                divisor16,
+                divisor32,
+                divisor64,
+            };
+
+            bool channelAInverted = false;
+            bool channelBInverted = false;
+            Control control;
+            ClockDivisor clockDivisor = ClockDivisor::divisor64;
+            std::optional<DeadTime> deadTime;
+        };
+
+        // Levels driven by the hardware on the outputs of the generator while it
+        // is faulted, without involving the CPU
+        struct SafeState
+        {
+            bool levelA = false;
+            bool levelB = false;
+        };
+
+        struct FaultConfig
+        {
+            GeneratorIndex generator;
+            uint8_t enabledFaultInputs;
+            uint8_t enabledComparatorInputs;
+            bool latch;
+            uint16_t minimumFaultPeriod;
+            std::optional<SafeState> safeState;
+        };
+
+        struct PinChannel
+        {
+            enum class Trigger
+            {
+                countZero,
+                countLoad,
+                countComparatorAUp,
+                countComparatorADown,
+                countComparatorBUp,
+                countComparatorBDown,
+            };
+
+            GeneratorIndex generator;
+
+            GpioPin& pinA = dummyPin;
+            GpioPin& pinB = dummyPin;
+
+            bool usesChannelA = false;
+            bool usesChannelB = false;
+
+            std::optional<Trigger> trigger;
+        };
+
+        struct PwmChannelType
+        {
+            __IO uint32_t CTL;
+            __IO uint32_t INTEN;
+            __IO uint32_t RIS;
+            __IO uint32_t ISC;
+            __IO uint32_t LOAD;
+            __IO uint32_t COUNT;
+            __IO uint32_t CMPA;
+            __IO uint32_t CMPB;
+            __IO uint32_t GENA;
+            __IO uint32_t GENB;
+            __IO uint32_t DBCTL;
+            __IO uint32_t DBRISE;
+            __IO uint32_t DBFALL;
+            __IO uint32_t FLTSRC0;
+            __IO uint32_t FLTSRC1;
+            __IO uint32_t MINFLTPER;
+        };
+
+        PwmCore(uint8_t pwmIndex, infra::MemoryRange<PinChannel> channels, const Config& config);
+        PwmCore(const PwmCore& other) = delete;
+        PwmCore& operator=(const PwmCore& other) = delete;
+        ~PwmCore();
+
+        PWM0_Type& Peripheral() const;
+        volatile PwmChannelType* Channel(GeneratorIndex generator) const;
+
+        void SetBaseFrequency(hal::Hertz baseFrequency);
+
+        // The load and compare values follow at the next commit, but a new clock divisor
+        // applies at once: the period in progress runs to its end at the new PWM clock.
+        // The dead band is rescaled with the divisor. On TM4C123 both PWM modules share
+        // the divisor, so it can only be changed while the other module is not clocked.
+        void SetBaseFrequency(const PwmFrequencyPlan& plan);
+        void Start(hal::Percent dutyCycle);
+        void Start(std::initializer_list<hal::Percent> dutyCycles);
+        void Stop();
+
+        void SetCompareValues(infra::MemoryRange<const uint16_t> compareValues);
+        void SetDutyCycles(infra::MemoryRange<const uint16_t> dutyCyclesQ15);
+        void StageLoad(uint16_t load);
+        uint16_t Load() const;
+        void Commit() const;
+        bool IsCommitPending() const;
+
+        void ConfigureFault(const FaultConfig& faultConfig);
+        void ClearFaults();
+        uint8_t FaultedGenerators() const;
+        uint8_t FaultInputs(GeneratorIndex generator) const;
+        uint8_t FaultComparatorInputs(GeneratorIndex generator) const;
+
+        static uint16_t CalculateDeadTimeCycles(std::chrono::nanoseconds deadTime, Config::ClockDivisor divisor);
+
+    private:
+        struct Generator
+        {
+            Generator(PinChannel& pins, volatile PwmChannelType* address);
+
+            std::optional<PeripheralPin> a;
+            std::optional<PeripheralPin> b;
+            volatile PwmChannelType* const address;
+            uint32_t enable = 0;
+            uint32_t generatorId = 0;
+            std::optional<PinChannel::Trigger> trigger;
+            uint32_t load = 0;
+            uint32_t span = 0; // Counts covered by a 100% duty cycle on one side of the period
+        };
+
+        void GeneratorConfiguration(Generator& generator) const;
+        void EnableDeadBand(Generator& generator) const;
+        void RescaleDeadBand(uint32_t fromDivisor, uint32_t toDivisor) const;
+        void SetComparator(Generator& generator, const hal::Percent& dutyCycle) const;
+        void WriteComparator(const Generator& generator, uint32_t compareValue) const;
+        void Run();
+        bool IsCenterAligned() const;
+        void EnableClock() const;
+        void DisableClock() const;
+
+    private:
+        uint8_t pwmIndex;
+        const Config& config;
+        infra::BoundedVector<Generator>::WithMaxSize<4> generators;
+        uint32_t generatorMask = 0;
+        bool running = false;
+    };
+}
+
+#endif
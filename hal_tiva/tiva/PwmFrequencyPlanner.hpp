@@ -0,0 +1,54 @@
+#ifndef HAL_PWM_FREQUENCY_PLANNER_TIVA_HPP
+#define HAL_PWM_FREQUENCY_PLANNER_TIVA_HPP
+
+#include "hal_tiva/tiva/PwmCore.hpp"
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <optional>
+
+namespace hal::tiva
+{
+    struct PwmFrequencyPlan
+    {
+        PwmCore::Config::ClockDivisor divisor;
+        PwmCore::Config::Control::Mode mode;
+        uint16_t load;
+        uint32_t achievedFrequency; // Hz, after rounding the period to whole PWM clocks
+        uint8_t resolutionBits;     // Of the duty cycle
+    };
+
+    // Chooses the smallest clock divisor for which the period still fits the 16-bit
+    // counter, which maximizes the number of duty cycle steps. Returns nothing when the
+    // frequency cannot be reached; use value() in a constant expression to reject such
+    // a plan at compile time.
+    constexpr std::optional<PwmFrequencyPlan> PlanPwmFrequency(uint32_t systemClock, uint32_t frequency, PwmCore::Config::Control::Mode mode)
+    {
+        constexpr std::array<uint32_t, 7> divisors = { { 1, 2, 4, 8, 16, 32, 64 } };
+
+        if (frequency == 0)
+            return std::nullopt;
+
+        bool centerAligned = mode == PwmCore::Config::Control::Mode::centerAligned;
+
+        for (std::size_t index = 0; index != divisors.size(); ++index)
+        {
+            uint32_t pwmClock = systemClock / divisors[index];
+            uint32_t counts = pwmClock / frequency;
+            uint32_t load = centerAligned ? counts / 2 : counts - 1;
+
+            if (counts < 2 || load > 0xffff)
+                continue;
+
+            // Center-aligned counters step through the period twice
+            uint32_t achievedCounts = centerAligned ? load * 2 : load + 1;
+            uint32_t steps = load + 1;
+
+            return PwmFrequencyPlan{ static_cast<PwmCore::Config::ClockDivisor>(index), mode, static_cast<uint16_t>(load), pwmClock / achievedCounts, static_cast<uint8_t>(std::bit_width(steps) - 1) };
+        }
+
+        return std::nullopt;
+    }
+}
+
+#endif
@@ -0,0 +1,129 @@
+#include "hal_tiva/tiva/QuadSpiMaster.hpp"
+#include "infra/util/ReallyAssert.hpp"
+
+namespace hal::tiva
+{
+    namespace
+    {
+        constexpr const uint32_t SSI_CR1_DIR = 0x00000100;           // SSI Direction of Operation
+        constexpr const uint32_t SSI_CR1_MODE_M = 0x000000C0;        // SSI Mode
+        constexpr const uint32_t SSI_CR1_MODE_LEGACY = 0x00000000;   // Legacy SSI mode
+        constexpr const uint32_t SSI_CR1_MODE_BI = 0x00000040;       // Bi-SSI mode
+        constexpr const uint32_t SSI_CR1_MODE_QUAD = 0x00000080;     // Quad-SSI Mode
+        constexpr const uint32_t SSI_CR1_MODE_ADVANCED = 0x000000C0; // Advanced SSI Mode with 8-bit packet size
+
+        constexpr const uint32_t SSI_SR_BSY = 0x00000010; // SSI Busy Bit
+        constexpr const uint32_t SSI_SR_RNE = 0x00000004; // SSI Receive FIFO Not Empty
+        constexpr const uint32_t SSI_SR_TNF = 0x00000002; // SSI Transmit FIFO Not Full
+
+        constexpr const uint32_t SSI_PP_MODE_M = 0x00000006;         // Mode of Operation
+        constexpr const uint32_t SSI_PP_MODE_ADVBIQUAD = 0x00000004; // Legacy mode, Advanced mode, Bi-SSI and Quad-SSI mode enabled
+
+        constexpr std::array<uint32_t, 3> modeForWidth = { {
+            SSI_CR1_MODE_ADVANCED,
+            SSI_CR1_MODE_BI,
+            SSI_CR1_MODE_QUAD,
+        } };
+
+        constexpr uint32_t Mode(QuadSpiMaster::Width width, bool read)
+        {
+            return modeForWidth[static_cast<uint8_t>(width)] | (read ? SSI_CR1_DIR : 0);
+        }
+    }
+
+    QuadSpiMaster::QuadSpiMaster(uint8_t aSpiIndex, GpioPin& clock, GpioPin& data0, GpioPin& data1, GpioPin& data2, GpioPin& data3, Dma& dma, const Config& config, GpioPin& slaveSelect)
+        : SpiMasterWithDma(aSpiIndex, clock, data1, data0, dma, config, slaveSelect)
+        , data2(data2, PinConfigPeripheral::spiData2)
+        , data3(data3, PinConfigPeripheral::spiData3)
+    {
+        really_assert((ssiArray[ssiIndex]->PP & SSI_PP_MODE_M) == SSI_PP_MODE_ADVBIQUAD);
+    }
+
+    QuadSpiMaster::~QuadSpiMaster()
+    {
+        SetMode(SSI_CR1_MODE_LEGACY);
+    }
+
+    void QuadSpiMaster::SendData(const Header& header, infra::ConstByteRange data, Lines lines, const infra::Function<void()>& onDone)
+    {
+        SendHeader(header, lines);
+        SetMode(Mode(lines.data, false));
+        Write(data);
+        WaitIdle();
+        Finish(infra::ByteRange(), onDone);
+    }
+
+    void QuadSpiMaster::ReceiveData(const Header& header, infra::ByteRange data, Lines lines, const infra::Function<void()>& onDone)
+    {
+        SendHeader(header, lines);
+        SetMode(Mode(lines.data, true));
+        Finish(data, onDone);
+    }
+
+    void QuadSpiMaster::SendHeader(const Header& header, Lines lines)
+    {
+        really_assert(bytesPerFrame == 1);
+
+        if (chipSelectConfigurator)
+            chipSelectConfigurator->StartSession();
+        continuedSession = true;
+
+        SetMode(Mode(lines.instruction, false));
+        Write(infra::MakeRange(header.instruction));
+        SetMode(Mode(lines.address, false));
+        Write(infra::MakeRange(header.address));
+        SetMode(Mode(lines.address, true));
+        ClockDummy(header.dummyBytes);
+    }
+
+    void QuadSpiMaster::Finish(infra::ByteRange receiveData, const infra::Function<void()>& onDone)
+    {
+        // The data phase, if any, runs through the DMA path of SpiMasterWithDma,
+        // which also ends the chip select session
+        onQuadDone = onDone;
+        SendAndReceive(infra::ConstByteRange(), receiveData, SpiAction::stop, [this]()
+            {
+                SetMode(SSI_CR1_MODE_LEGACY);
+                onQuadDone();
+            });
+    }
+
+    void QuadSpiMaster::SetMode(uint32_t mode)
+    {
+        WaitIdle();
+        ssiArray[ssiIndex]->CR1 = (ssiArray[ssiIndex]->CR1 & ~(SSI_CR1_DIR | SSI_CR1_MODE_M)) | mode;
+    }
+
+    void QuadSpiMaster::Write(infra::ConstByteRange data)
+    {
+        for (auto byte : data)
+        {
+            while ((ssiArray[ssiIndex]->SR & SSI_SR_TNF) == 0)
+            {
+            }
+
+            ssiArray[ssiIndex]->DR = byte;
+        }
+    }
+
+    void QuadSpiMaster::ClockDummy(uint8_t bytes)
+    {
+        for (uint8_t i = 0; i != bytes; ++i)
+        {
+            ssiArray[ssiIndex]->DR = 0;
+
+            while ((ssiArray[ssiIndex]->SR & SSI_SR_RNE) == 0)
+            {
+            }
+
+            static_cast<void>(ssiArray[ssiIndex]->DR);
+        }
+    }
+
+    void QuadSpiMaster::WaitIdle()
+    {
+        while ((ssiArray[ssiIndex]->SR & SSI_SR_BSY) != 0)
+        {
+        }
+    }
+}
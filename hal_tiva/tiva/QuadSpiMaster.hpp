@@ -0,0 +1,58 @@
+#ifndef HAL_QUAD_SPI_MASTER_TIVA_HPP
+#define HAL_QUAD_SPI_MASTER_TIVA_HPP
+
+#include "hal_tiva/tiva/SpiMasterWithDma.hpp"
+#include "infra/util/BoundedVector.hpp"
+
+namespace hal::tiva
+{
+    // Advanced, Bi- and Quad-SSI transfers on top of a legacy SpiMaster. The
+    // chip select is expected to be driven by a ChipSelectConfigurator, so it
+    // stays asserted across the command, address, dummy and data phases.
+    class QuadSpiMaster
+        : public SpiMasterWithDma
+    {
+    public:
+        enum class Width : uint8_t
+        {
+            single,
+            dual,
+            quad,
+        };
+
+        struct Lines
+        {
+            Width instruction = Width::single;
+            Width address = Width::single;
+            Width data = Width::single;
+        };
+
+        struct Header
+        {
+            infra::BoundedVector<uint8_t>::WithMaxSize<1> instruction;
+            infra::BoundedVector<uint8_t>::WithMaxSize<4> address;
+            uint8_t dummyBytes = 0; // Clocked as reads on the address lines, a byte is 8, 4 or 2 clocks
+        };
+
+        QuadSpiMaster(uint8_t aSpiIndex, GpioPin& clock, GpioPin& data0, GpioPin& data1, GpioPin& data2, GpioPin& data3, Dma& dma, const Config& config = Config(), GpioPin& slaveSelect = dummyPin);
+        ~QuadSpiMaster();
+
+        void SendData(const Header& header, infra::ConstByteRange data, Lines lines, const infra::Function<void()>& onDone);
+        void ReceiveData(const Header& header, infra::ByteRange data, Lines lines, const infra::Function<void()>& onDone);
+
+    private:
+        void SendHeader(const Header& header, Lines lines);
+        void Finish(infra::ByteRange receiveData, const infra::Function<void()>& onDone);
+        void SetMode(uint32_t mode);
+        void Write(infra::ConstByteRange data);
+        void ClockDummy(uint8_t bytes);
+        void WaitIdle();
+
+    private:
+        PeripheralPin data2;
+        PeripheralPin data3;
+        infra::AutoResetFunction<void()> onQuadDone;
+    };
+}
+
+#endif
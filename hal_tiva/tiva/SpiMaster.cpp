@@ -1,35 +1,38 @@
 #include "hal_tiva/tiva/SpiMaster.hpp"
 #include "infra/event/EventDispatcher.hpp"
 #include "infra/util/BitLogic.hpp"
+#include "infra/util/ReallyAssert.hpp"
+#include <algorithm>
 
 extern "C" uint32_t SystemCoreClock;
 
+namespace
+{
+    extern "C" void Ssi0_Handler()
+    {
+        hal::InterruptTable::Instance().Invoke(SSI0_IRQn);
+    }
+
+    extern "C" void Ssi1_Handler()
+    {
+        hal::InterruptTable::Instance().Invoke(SSI1_IRQn);
+    }
+
+    extern "C" void Ssi2_Handler()
+    {
+        hal::InterruptTable::Instance().Invoke(SSI2_IRQn);
+    }
+
+    extern "C" void Ssi3_Handler()
+    {
+        hal::InterruptTable::Instance().Invoke(SSI3_IRQn);
+    }
+}
+
 namespace hal::tiva
 {
     namespace
     {
-        constexpr const uint32_t SSI_CR0_SCR_M = 0x0000FF00;    // SSI Serial Clock Rate
-        constexpr const uint32_t SSI_CR0_SPH = 0x00000080;      // SSI Serial Clock Phase
-        constexpr const uint32_t SSI_CR0_SPO = 0x00000040;      // SSI Serial Clock Polarity
-        constexpr const uint32_t SSI_CR0_FRF_M = 0x00000030;    // SSI Frame Format Select
-        constexpr const uint32_t SSI_CR0_FRF_MOTO = 0x00000000; // Freescale SPI Frame Format
-        constexpr const uint32_t SSI_CR0_FRF_TI = 0x00000010;   // Synchronous Serial Frame Format
-        constexpr const uint32_t SSI_CR0_DSS_M = 0x0000000F;    // SSI Data Size Select
-        constexpr const uint32_t SSI_CR0_DSS_4 = 0x00000003;    // 4-bit data
-        constexpr const uint32_t SSI_CR0_DSS_5 = 0x00000004;    // 5-bit data
-        constexpr const uint32_t SSI_CR0_DSS_6 = 0x00000005;    // 6-bit data
-        constexpr const uint32_t SSI_CR0_DSS_7 = 0x00000006;    // 7-bit data
-        constexpr const uint32_t SSI_CR0_DSS_8 = 0x00000007;    // 8-bit data
-        constexpr const uint32_t SSI_CR0_DSS_9 = 0x00000008;    // 9-bit data
-        constexpr const uint32_t SSI_CR0_DSS_10 = 0x00000009;   // 10-bit data
-        constexpr const uint32_t SSI_CR0_DSS_11 = 0x0000000A;   // 11-bit data
-        constexpr const uint32_t SSI_CR0_DSS_12 = 0x0000000B;   // 12-bit data
-        constexpr const uint32_t SSI_CR0_DSS_13 = 0x0000000C;   // 13-bit data
-        constexpr const uint32_t SSI_CR0_DSS_14 = 0x0000000D;   // 14-bit data
-        constexpr const uint32_t SSI_CR0_DSS_15 = 0x0000000E;   // 15-bit data
-        constexpr const uint32_t SSI_CR0_DSS_16 = 0x0000000F;   // 16-bit data
-        constexpr const uint32_t SSI_CR0_SCR_S = 8;
-
         constexpr const uint32_t SSI_CR1_EOM = 0x00000800;         // Stop Frame (End of Message)
         constexpr const uint32_t SSI_CR1_FSSHLDFRM = 0x00000400;   // FSS Hold Frame
         constexpr const uint32_t SSI_CR1_HSCLKEN = 0x00000200;     // High Speed Clock Enable
@@ -52,9 +55,6 @@ namespace hal::tiva
         constexpr const uint32_t SSI_SR_TNF = 0x00000002; // SSI Transmit FIFO Not Full
         constexpr const uint32_t SSI_SR_TFE = 0x00000001; // SSI Transmit FIFO Empty
 
-        constexpr const uint32_t SSI_CPSR_CPSDVSR_M = 0x000000FF; // SSI Clock Prescale Divisor
-        constexpr const uint32_t SSI_CPSR_CPSDVSR_S = 0;
-
         constexpr const uint32_t SSI_IM_EOTIM = 0x00000040;   // End of Transmit Interrupt Mask
         constexpr const uint32_t SSI_IM_DMATXIM = 0x00000020; // SSI Transmit DMA Interrupt Mask
         constexpr const uint32_t SSI_IM_DMARXIM = 0x00000010; // SSI Receive DMA Interrupt Mask
@@ -99,17 +99,13 @@ namespace hal::tiva
         constexpr const uint32_t SSI_CC_CS_SYSPLL = 0x00000000; // System clock (based on clocksource and divisor factor)
         constexpr const uint32_t SSI_CC_CS_PIOSC = 0x00000005;  // PIOSC
 
-        constexpr uint32_t phase_polarity(bool phase1st, bool polarityLow)
-        {
-            uint32_t phasePolarity = 0;
+        // Depth of both the TX and RX FIFO. Never having more frames in flight
+        // than this guarantees that the RX FIFO cannot overrun.
+        constexpr const std::size_t fifoDepth = 8;
 
-            if (!phase1st)
-                phasePolarity |= SSI_CR0_SPH;
-
-            if (!polarityLow)
-                phasePolarity |= SSI_CR0_SPO;
-
-            return phasePolarity;
+        SsiFormat ToSsiFormat(const SpiMaster::Config& config)
+        {
+            return SsiFormat{ config.polarityLow, config.phase1st, config.dataSize, CalculateSsiClockRate(SystemCoreClock, config.baudRate) };
         }
 
         constexpr std::array<uint32_t, 4> peripheralSsiArray = { {
@@ -135,6 +131,11 @@ namespace hal::tiva
         , miso(miso, PinConfigPeripheral::spiMiso)
         , mosi(mosi, PinConfigPeripheral::spiMosi)
         , slaveSelect(slaveSelect, PinConfigPeripheral::spiSlaveSelect)
+        , spiInterruptRegistration(peripheralIrqSsiArray[aSpiIndex], [this]()
+              {
+                  HandleInterrupt();
+              })
+        , defaultFormat(ToSsiFormat(config))
     {
         ssiArray = peripheralSsi;
         irqArray = infra::MakeRange(peripheralIrqSsiArray);
@@ -142,29 +143,17 @@ namespace hal::tiva
         EnableClock();
         ssiArray[ssiIndex]->CR1 &= ~SSI_CR1_SSE; /* Disable SPI */
 
-        auto max = SystemCoreClock / config.baudRate;
-        uint32_t div = 0;
-        uint32_t scr = 0;
-        do
-        {
-            div += 2;
-            scr = (max / div) - 1;
-        } while (scr > 255);
-
-        ssiArray[ssiIndex]->CC = SSI_CC_CS_SYSPLL;                                                                                  /* SSI clock is sourced by main system clock  */
-        ssiArray[ssiIndex]->CR1 &= ~SSI_CR1_MS;                                                                                     /* Enable master mode */
-        ssiArray[ssiIndex]->CR1 |= SSI_CR1_EOT;                                                                                     /* Enable end of transmission */
-        ssiArray[ssiIndex]->CR0 = (ssiArray[ssiIndex]->CR0 & ~SSI_CR0_DSS_M) | SSI_CR0_DSS_8;                                       /* Configure number of bits */
-        ssiArray[ssiIndex]->CR0 = (ssiArray[ssiIndex]->CR0 & ~SSI_CR0_FRF_M) | SSI_CR0_FRF_MOTO;                                    /* Configure to SPI freescale format */
-        ssiArray[ssiIndex]->CR0 = (ssiArray[ssiIndex]->CR0 & ~SSI_CR0_SCR_M) | phase_polarity(config.phase1st, config.polarityLow); /* Configure SPI phase/polarity */
-        ssiArray[ssiIndex]->CR0 = (ssiArray[ssiIndex]->CR0 & ~SSI_CR0_SCR_M) | ((scr & 0xFF) << SSI_CR0_SCR_S);                     /* Sets clock rate */
-        ssiArray[ssiIndex]->CPSR = (ssiArray[ssiIndex]->CPSR & ~SSI_CPSR_CPSDVSR_M) | div;                                          /* Sets prescaler */
+        ssiArray[ssiIndex]->CC = SSI_CC_CS_SYSPLL; /* SSI clock is sourced by main system clock  */
+        ssiArray[ssiIndex]->CR1 &= ~SSI_CR1_MS;    /* Enable master mode */
+        ssiArray[ssiIndex]->CR1 |= SSI_CR1_EOT;    /* Enable end of transmission */
+        ApplyFormat(defaultFormat);
 
         ssiArray[ssiIndex]->CR1 |= SSI_CR1_SSE; /* Enable SPI */
     }
 
     SpiMaster::~SpiMaster()
     {
+        ssiArray[ssiIndex]->IM = 0;
         ssiArray[ssiIndex]->CR1 &= ~SSI_CR1_SSE; /* Disable SPI */
         DisableClock();
     }
@@ -176,24 +165,58 @@ namespace hal::tiva
             chipSelectConfigurator->StartSession();
         continuedSession = nextAction == SpiAction::continueSession;
 
+        StartTransfer(sendData, receiveData);
+    }
+
+    uint32_t SpiMaster::BaudRate() const
+    {
+        return activeFormat.clockRate.baudRate;
+    }
+
+    void SpiMaster::ExecuteTransactions(infra::MemoryRange<const Transaction> transactions, const infra::Function<void()>& onDone)
+    {
+        really_assert(!transactions.empty());
+        really_assert(this->transactions.empty());
+
+        this->onDone = onDone;
+        this->transactions = transactions;
+        StartTransaction();
+    }
+
+    void SpiMaster::ApplyFormat(const SsiFormat& format)
+    {
+        ConfigureSsi(*ssiArray[ssiIndex], format);
+        activeFormat = format;
+        bytesPerFrame = format.dataSize > 8 ? 2 : 1;
+    }
+
+    void SpiMaster::StartTransaction()
+    {
+        const auto& transaction = transactions.front();
+
+        if (transaction.communicationConfigurator)
+            transaction.communicationConfigurator->ActivateConfiguration();
+        if (transaction.chipSelectConfigurator)
+            transaction.chipSelectConfigurator->StartSession();
+
+        StartTransfer(transaction.sendData, transaction.receiveData);
+    }
+
+    void SpiMaster::StartTransfer(infra::ConstByteRange sendData, infra::ByteRange receiveData)
+    {
         assert(sendData.size() == receiveData.size() || sendData.empty() || receiveData.empty());
+        really_assert(sendData.size() % bytesPerFrame == 0 && receiveData.size() % bytesPerFrame == 0);
         this->sendData = sendData;
         this->receiveData = receiveData;
-        sending = !sendData.empty();
-        receiving = !receiveData.empty();
+        framesToSend = std::max(sendData.size(), receiveData.size()) / bytesPerFrame;
+        framesToReceive = framesToSend;
 
-        if (!sending)
-            dummyToSend = receiveData.size();
-        if (!receiving)
-            dummyToReceive = sendData.size();
+        FillTxFifo();
 
-        really_assert(!spiInterruptRegistration);
-        spiInterruptRegistration.emplace(irqArray[ssiIndex], [this]()
-            {
-                HandleInterrupt();
-            });
-
-        ssiArray[ssiIndex]->IM |= SSI_IM_TXIM | SSI_IM_RXIM | SSI_IM_RORIM; /* Enable RX/TX interrupt */
+        if (framesToSend != 0)
+            ssiArray[ssiIndex]->IM |= SSI_IM_RXIM | SSI_IM_RORIM; /* Refill when the RX FIFO is half full */
+        else
+            ssiArray[ssiIndex]->IM |= SSI_IM_TXIM | SSI_IM_RORIM; /* Everything is queued, wait for end of transmission */
     }
 
     void SpiMaster::SetChipSelectConfigurator(ChipSelectConfigurator& configurator)
@@ -217,65 +240,98 @@ namespace hal::tiva
 
     void SpiMaster::HandleInterrupt()
     {
-        uint32_t status = ssiArray[ssiIndex]->SR;
-
-        if ((status & SSI_RIS_RORRIS))
-        {
-            ssiArray[ssiIndex]->ICR |= SSI_ICR_RORIC;
+        uint32_t status = ssiArray[ssiIndex]->MIS;
 
-            really_assert(status & SSI_RIS_RORRIS);
-        }
+        really_assert((status & SSI_MIS_RORMIS) == 0);
 
-        if ((status & SSI_RIS_RXRIS))
+        if ((status & SSI_MIS_TXMIS) != 0)
         {
-            if (dummyToReceive != 0)
-            {
-                (void)ssiArray[ssiIndex]->DR;
-                --dummyToReceive;
-            }
-            else if (receiving)
+            while ((ssiArray[ssiIndex]->SR & SSI_SR_BSY) != 0)
             {
-                receiveData.front() = ssiArray[ssiIndex]->DR;
-                receiveData.pop_front();
             }
+        }
 
-            receiving &= !receiveData.empty();
+        DrainRxFifo();
+        FillTxFifo();
 
-            if (dummyToReceive == 0 && !receiving)
-                ssiArray[ssiIndex]->IM &= ~SSI_IM_RXIM;
+        if (framesToSend == 0)
+            ssiArray[ssiIndex]->IM = (ssiArray[ssiIndex]->IM & ~SSI_IM_RXIM) | SSI_IM_TXIM;
+
+        spiInterruptRegistration.ClearPending();
+
+        if (framesToReceive == 0)
+        {
+            ssiArray[ssiIndex]->IM &= ~(SSI_IM_TXIM | SSI_IM_RORIM);
+            FinishTransfer();
         }
+    }
 
-        if ((status & SSI_RIS_TXRIS) != 0)
+    void SpiMaster::FinishTransfer()
+    {
+        if (!transactions.empty())
         {
-            if (dummyToSend != 0)
+            const auto& transaction = transactions.front();
+
+            if (transaction.chipSelectConfigurator)
+                transaction.chipSelectConfigurator->EndSession();
+            if (transaction.communicationConfigurator)
+                transaction.communicationConfigurator->DeactivateConfiguration();
+            if (transaction.onDone)
+                infra::EventDispatcher::Instance().Schedule(transaction.onDone);
+
+            transactions.pop_front();
+            if (!transactions.empty())
             {
-                reinterpret_cast<volatile uint8_t&>(ssiArray[ssiIndex]->DR) = 0;
-                --dummyToSend;
+                StartTransaction();
+                return;
             }
-            else if (sending)
+        }
+        else if (chipSelectConfigurator && !continuedSession)
+            chipSelectConfigurator->EndSession();
+
+        infra::EventDispatcher::Instance().Schedule([this]()
             {
-                reinterpret_cast<volatile uint8_t&>(ssiArray[ssiIndex]->DR) = sendData.front();
-                sendData.pop_front();
-            }
+                onDone();
+            });
+    }
 
-            sending &= !sendData.empty();
+    // Frames are shifted out most significant bit first, so the first byte
+    // of a pair goes in the upper half to keep the byte order on the bus
+    void SpiMaster::FillTxFifo()
+    {
+        while (framesToSend != 0 && framesToReceive - framesToSend < fifoDepth)
+        {
+            uint32_t data = 0;
 
-            // After the first transmit, disable interrupt on transmit buffer empty,
-            // so that a receive is done before each transmit
-            ssiArray[ssiIndex]->IM &= ~SSI_IM_TXIM;
-        }
+            for (std::size_t i = 0; i != bytesPerFrame; ++i)
+            {
+                data <<= 8;
 
-        spiInterruptRegistration->ClearPending();
+                if (!sendData.empty())
+                {
+                    data |= sendData.front();
+                    sendData.pop_front();
+                }
+            }
+
+            ssiArray[ssiIndex]->DR = data;
+            --framesToSend;
+        }
+    }
 
-        if (!sending && !receiving && dummyToSend == 0 && dummyToReceive == 0)
+    void SpiMaster::DrainRxFifo()
+    {
+        while (framesToReceive != framesToSend && (ssiArray[ssiIndex]->SR & SSI_SR_RNE) != 0)
         {
-            spiInterruptRegistration = std::nullopt;
-            if (chipSelectConfigurator && !continuedSession)
-                chipSelectConfigurator->EndSession();
-            infra::EventDispatcher::Instance().Schedule([this]()
-                {
-                    onDone();
-                });
+            uint32_t data = ssiArray[ssiIndex]->DR;
+
+            for (std::size_t i = bytesPerFrame; i != 0 && !receiveData.empty(); --i)
+            {
+                receiveData.front() = static_cast<uint8_t>(data >> (8 * (i - 1)));
+                receiveData.pop_front();
+            }
+
+            --framesToReceive;
         }
     }
 
@@ -292,4 +348,24 @@ namespace hal::tiva
     {
         infra::ReplaceBit(SYSCTL->RCGCSSI, false, ssiIndex);
     }
+
+    SpiMaster::Configurator::Configurator(SpiMaster& spiMaster, const Config& config)
+        : spiMaster(spiMaster)
+        , format(ToSsiFormat(config))
+    {}
+
+    void SpiMaster::Configurator::ActivateConfiguration()
+    {
+        spiMaster.ApplyFormat(format);
+    }
+
+    void SpiMaster::Configurator::DeactivateConfiguration()
+    {
+        spiMaster.ApplyFormat(spiMaster.defaultFormat);
+    }
+
+    uint32_t SpiMaster::Configurator::BaudRate() const
+    {
+        return format.clockRate.baudRate;
+    }
 }
@@ -4,8 +4,8 @@
 #include "hal/interfaces/Spi.hpp"
 #include "hal_tiva/cortex/InterruptCortex.hpp"
 #include "hal_tiva/tiva/Gpio.hpp"
+#include "hal_tiva/tiva/Ssi.hpp"
 #include "infra/util/AutoResetFunction.hpp"
-#include <optional>
 
 namespace hal::tiva
 {
@@ -21,6 +21,36 @@ namespace hal::tiva
             bool polarityLow = true;
             bool phase1st = true;
             uint32_t baudRate = 100000;
+            uint8_t dataSize = 8; // Frames of more than 8 bits take two bytes, most significant first
+        };
+
+        // Switches bit rate, mode and frame size while a device is selected,
+        // so devices of different speeds can share the bus
+        class Configurator
+            : public CommunicationConfigurator
+        {
+        public:
+            Configurator(SpiMaster& spiMaster, const Config& config);
+
+            void ActivateConfiguration() override;
+            void DeactivateConfiguration() override;
+
+            uint32_t BaudRate() const;
+
+        private:
+            SpiMaster& spiMaster;
+            SsiFormat format;
+        };
+
+        // A transaction is a complete chip select session. Configurators
+        // are invoked from interrupt context while the queue is processed.
+        struct Transaction
+        {
+            infra::ConstByteRange sendData;
+            infra::ByteRange receiveData;
+            ChipSelectConfigurator* chipSelectConfigurator = nullptr;
+            CommunicationConfigurator* communicationConfigurator = nullptr;
+            infra::Function<void()> onDone;
         };
 
         SpiMaster(uint8_t aSpiIndex, GpioPin& clock, GpioPin& miso, GpioPin& mosi, const Config& config = Config(), GpioPin& slaveSelect = dummyPin);
@@ -31,12 +61,25 @@ namespace hal::tiva
         virtual void SetCommunicationConfigurator(CommunicationConfigurator& configurator) override;
         virtual void ResetCommunicationConfigurator() override;
 
+        uint32_t BaudRate() const;
+
+        // Runs all transactions back-to-back, onDone is called after the last one
+        void ExecuteTransactions(infra::MemoryRange<const Transaction> transactions, const infra::Function<void()>& onDone);
+
+    protected:
+        virtual void StartTransfer(infra::ConstByteRange sendData, infra::ByteRange receiveData);
+        virtual void HandleInterrupt();
+        void FinishTransfer();
+
     private:
-        void HandleInterrupt();
+        void ApplyFormat(const SsiFormat& format);
+        void StartTransaction();
+        void FillTxFifo();
+        void DrainRxFifo();
         void EnableClock();
         void DisableClock();
 
-    private:
+    protected:
         uint8_t ssiIndex;
         PeripheralPin clock;
         PeripheralPin miso;
@@ -49,14 +92,18 @@ namespace hal::tiva
         infra::AutoResetFunction<void()> onDone;
         ChipSelectConfigurator* chipSelectConfigurator = nullptr;
         CommunicationConfigurator* communicationConfigurator = nullptr;
-        std::optional<ImmediateInterruptHandler> spiInterruptRegistration;
+        ImmediateInterruptHandler spiInterruptRegistration;
+        bool continuedSession = false;
+        std::size_t bytesPerFrame = 1;
+
+    private:
+        SsiFormat defaultFormat;
+        SsiFormat activeFormat;
+        infra::MemoryRange<const Transaction> transactions;
         infra::ConstByteRange sendData;
         infra::ByteRange receiveData;
-        bool sending;
-        bool receiving;
-        uint32_t dummyToSend = 0;
-        uint32_t dummyToReceive = 0;
-        bool continuedSession = false;
+        std::size_t framesToSend = 0;
+        std::size_t framesToReceive = 0;
     };
 }
 
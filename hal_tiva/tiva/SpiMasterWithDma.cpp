@@ -0,0 +1,141 @@
+#include "hal_tiva/tiva/SpiMasterWithDma.hpp"
+#include "infra/util/ReallyAssert.hpp"
+#include <algorithm>
+
+namespace hal::tiva
+{
+    namespace
+    {
+        constexpr const uint32_t SSI_IM_DMARXIM = 0x00000010; // SSI Receive DMA Interrupt Mask
+        constexpr const uint32_t SSI_IM_RORIM = 0x00000001;   // SSI Receive Overrun Interrupt Mask
+
+        constexpr const uint32_t SSI_MIS_RORMIS = 0x00000001; // SSI Receive Overrun Masked Interrupt Status
+
+        constexpr const uint32_t SSI_ICR_DMATXIC = 0x00000020; // SSI Transmit DMA Interrupt Clear
+        constexpr const uint32_t SSI_ICR_DMARXIC = 0x00000010; // SSI Receive DMA Interrupt Clear
+
+        constexpr const uint32_t SSI_DMACTL_TXDMAE = 0x00000002; // Transmit DMA Enable
+        constexpr const uint32_t SSI_DMACTL_RXDMAE = 0x00000001; // Receive DMA Enable
+
+        struct SsiDma
+        {
+            DmaChannel::Channel tx;
+            DmaChannel::Channel rx;
+        };
+
+        constexpr const std::array<SsiDma, 4> ssiDmaChannels = { {
+            { { 11, 0 }, { 10, 0 } },
+            { { 25, 0 }, { 24, 0 } },
+            { { 13, 2 }, { 12, 2 } },
+            { { 15, 2 }, { 14, 2 } },
+        } };
+
+        // RX has priority over TX so that the receive FIFO is always emptied
+        // before it can overrun, TX is at most a FIFO depth ahead.
+        constexpr DmaChannel::Attributes txAttributes{ false, false, false, false };
+        constexpr DmaChannel::Attributes rxAttributes{ false, false, true, false };
+        constexpr DmaChannel::ControlBlock controlBlockTx{ DmaChannel::Increment::_8_bits, DmaChannel::Increment::none, DmaChannel::DataSize::_8_bits, DmaChannel::ArbitrationSize::_4_items };
+        constexpr DmaChannel::ControlBlock controlBlockRx{ DmaChannel::Increment::none, DmaChannel::Increment::_8_bits, DmaChannel::DataSize::_8_bits, DmaChannel::ArbitrationSize::_4_items };
+
+        // The memory side increments unless a dummy byte is used, frames of
+        // more than 8 bits are moved as half words
+        DmaChannel::ControlBlock MakeControlBlock(bool toPeripheral, bool dummy, std::size_t bytesPerFrame)
+        {
+            auto dataSize = bytesPerFrame == 2 ? DmaChannel::DataSize::_16_bits : DmaChannel::DataSize::_8_bits;
+            auto increment = dummy ? DmaChannel::Increment::none : (bytesPerFrame == 2 ? DmaChannel::Increment::_16_bits : DmaChannel::Increment::_8_bits);
+
+            if (toPeripheral)
+                return DmaChannel::ControlBlock{ increment, DmaChannel::Increment::none, dataSize, DmaChannel::ArbitrationSize::_4_items };
+            else
+                return DmaChannel::ControlBlock{ DmaChannel::Increment::none, increment, dataSize, DmaChannel::ArbitrationSize::_4_items };
+        }
+    }
+
+    SpiMasterWithDma::SpiMasterWithDma(uint8_t aSpiIndex, GpioPin& clock, GpioPin& miso, GpioPin& mosi, Dma& dma, const Config& config, GpioPin& slaveSelect)
+        : SpiMaster(aSpiIndex, clock, miso, mosi, config, slaveSelect)
+        , dmaTx{ dma, ssiDmaChannels[aSpiIndex].tx, DmaChannel::Configuration{ txAttributes, controlBlockTx } }
+        , dmaRx{ dma, ssiDmaChannels[aSpiIndex].rx, DmaChannel::Configuration{ rxAttributes, controlBlockRx } }
+    {
+        ssiArray[ssiIndex]->DMACTL |= SSI_DMACTL_TXDMAE | SSI_DMACTL_RXDMAE;
+    }
+
+    SpiMasterWithDma::~SpiMasterWithDma()
+    {
+        ssiArray[ssiIndex]->DMACTL &= ~(SSI_DMACTL_TXDMAE | SSI_DMACTL_RXDMAE);
+    }
+
+    void SpiMasterWithDma::StartTransfer(infra::ConstByteRange sendData, infra::ByteRange receiveData)
+    {
+        really_assert(sendData.size() == receiveData.size() || sendData.empty() || receiveData.empty());
+        really_assert(sendData.size() % bytesPerFrame == 0 && receiveData.size() % bytesPerFrame == 0);
+        really_assert(reinterpret_cast<uintptr_t>(sendData.begin()) % bytesPerFrame == 0 && reinterpret_cast<uintptr_t>(receiveData.begin()) % bytesPerFrame == 0);
+        this->sendData = sendData;
+        this->receiveData = receiveData;
+        bytesRemaining = std::max(sendData.size(), receiveData.size());
+
+        if (bytesRemaining == 0)
+        {
+            FinishTransfer();
+            return;
+        }
+
+        dmaTx.SetControlBlock(MakeControlBlock(true, sendData.empty(), bytesPerFrame));
+        dmaRx.SetControlBlock(MakeControlBlock(false, receiveData.empty(), bytesPerFrame));
+
+#if defined(TM4C129)
+        ssiArray[ssiIndex]->IM |= SSI_IM_DMARXIM | SSI_IM_RORIM;
+#else
+        ssiArray[ssiIndex]->IM |= SSI_IM_RORIM;
+#endif
+
+        StartChunk();
+    }
+
+    void SpiMasterWithDma::StartChunk()
+    {
+        auto& dr = ssiArray[ssiIndex]->DR;
+        chunkSize = std::min(bytesRemaining, dmaRx.MaxTransferSize() * bytesPerFrame);
+
+        volatile void* source = &dummyTx;
+        volatile void* destination = &dummyRx;
+
+        if (!sendData.empty())
+            source = const_cast<uint8_t*>(sendData.begin());
+        if (!receiveData.empty())
+            destination = receiveData.begin();
+
+        // RX is armed before TX, the first TX request immediately starts clocking
+        dmaRx.StartTransfer(DmaChannel::Transfer::basic, DmaChannel::Buffers{ &dr, destination, chunkSize / bytesPerFrame });
+        dmaTx.StartTransfer(DmaChannel::Transfer::basic, DmaChannel::Buffers{ source, &dr, chunkSize / bytesPerFrame });
+    }
+
+    void SpiMasterWithDma::HandleInterrupt()
+    {
+        really_assert((ssiArray[ssiIndex]->MIS & SSI_MIS_RORMIS) == 0);
+
+#if defined(TM4C129)
+        ssiArray[ssiIndex]->ICR = SSI_ICR_DMATXIC | SSI_ICR_DMARXIC;
+#endif
+        spiInterruptRegistration.ClearPending();
+
+        // Both channels signal completion on the SSI interrupt, only the
+        // receive side marks the point where all frames have been clocked
+        if (chunkSize == 0 || !dmaRx.IsPrimaryTransferCompleted())
+            return;
+
+        bytesRemaining -= chunkSize;
+        if (!sendData.empty())
+            sendData.shrink_from_front_to(bytesRemaining);
+        if (!receiveData.empty())
+            receiveData.shrink_from_front_to(bytesRemaining);
+
+        if (bytesRemaining != 0)
+            StartChunk();
+        else
+        {
+            chunkSize = 0;
+            ssiArray[ssiIndex]->IM &= ~(SSI_IM_DMARXIM | SSI_IM_RORIM);
+            FinishTransfer();
+        }
+    }
+}
@@ -0,0 +1,35 @@
+#ifndef HAL_SPI_MASTER_WITH_DMA_TIVA_HPP
+#define HAL_SPI_MASTER_WITH_DMA_TIVA_HPP
+
+#include "hal_tiva/tiva/Dma.hpp"
+#include "hal_tiva/tiva/SpiMaster.hpp"
+
+namespace hal::tiva
+{
+    // The DMA cannot reorder bytes, so unlike SpiMaster, frames of more than 8 bits are
+    // moved as native half words: the buffers hold uint16_t frames, aligned to 2 bytes.
+    class SpiMasterWithDma
+        : public SpiMaster
+    {
+    public:
+        SpiMasterWithDma(uint8_t aSpiIndex, GpioPin& clock, GpioPin& miso, GpioPin& mosi, Dma& dma, const Config& config = Config(), GpioPin& slaveSelect = dummyPin);
+        ~SpiMasterWithDma();
+
+    private:
+        void StartTransfer(infra::ConstByteRange sendData, infra::ByteRange receiveData) override;
+        void StartChunk();
+        void HandleInterrupt() override;
+
+    private:
+        DmaChannel dmaTx;
+        DmaChannel dmaRx;
+        infra::ConstByteRange sendData;
+        infra::ByteRange receiveData;
+        std::size_t bytesRemaining = 0;
+        std::size_t chunkSize = 0;
+        uint16_t dummyTx = 0;
+        uint16_t dummyRx = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,259 @@
+#include "hal_tiva/tiva/SpiSlaveWithDma.hpp"
+#include "infra/event/EventDispatcher.hpp"
+#include "infra/util/BitLogic.hpp"
+#include "infra/util/ReallyAssert.hpp"
+#include <algorithm>
+
+extern "C" uint32_t SystemCoreClock;
+
+namespace hal::tiva
+{
+    namespace
+    {
+        constexpr const uint32_t SSI_CR1_MS = 0x00000004;  // SSI Master/Slave Select
+        constexpr const uint32_t SSI_CR1_SSE = 0x00000002; // SSI Synchronous Serial Port Enable
+
+        constexpr const uint32_t SSI_SR_RNE = 0x00000004; // SSI Receive FIFO Not Empty
+        constexpr const uint32_t SSI_SR_TFE = 0x00000001; // SSI Transmit FIFO Empty
+
+        constexpr const uint32_t SSI_IM_DMARXIM = 0x00000010; // SSI Receive DMA Interrupt Mask
+        constexpr const uint32_t SSI_IM_RTIM = 0x00000002;    // SSI Receive Time-Out Interrupt Mask
+
+        constexpr const uint32_t SSI_MIS_RTMIS = 0x00000002; // SSI Receive Time-Out Masked Interrupt Status
+
+        constexpr const uint32_t SSI_ICR_DMATXIC = 0x00000020; // SSI Transmit DMA Interrupt Clear
+        constexpr const uint32_t SSI_ICR_DMARXIC = 0x00000010; // SSI Receive DMA Interrupt Clear
+        constexpr const uint32_t SSI_ICR_RTIC = 0x00000002;    // SSI Receive Time-Out Interrupt Clear
+        constexpr const uint32_t SSI_ICR_RORIC = 0x00000001;   // SSI Receive Overrun Interrupt Clear
+
+        constexpr const uint32_t SSI_DMACTL_TXDMAE = 0x00000002; // Transmit DMA Enable
+        constexpr const uint32_t SSI_DMACTL_RXDMAE = 0x00000001; // Receive DMA Enable
+
+        constexpr const uint32_t SSI_CC_CS_SYSPLL = 0x00000000; // System clock (based on clocksource and divisor factor)
+
+        constexpr const uint32_t receiveTimeOutBits = 32;
+
+        struct SsiDma
+        {
+            DmaChannel::Channel tx;
+            DmaChannel::Channel rx;
+        };
+
+        constexpr const std::array<SsiDma, 4> ssiDmaChannels = { {
+            { { 11, 0 }, { 10, 0 } },
+            { { 25, 0 }, { 24, 0 } },
+            { { 13, 2 }, { 12, 2 } },
+            { { 15, 2 }, { 14, 2 } },
+        } };
+
+        constexpr std::array<uint32_t, 4> peripheralSsiArray = { {
+            SSI0_BASE,
+            SSI1_BASE,
+            SSI2_BASE,
+            SSI3_BASE,
+        } };
+
+        constexpr std::array<IRQn_Type, 4> peripheralIrqSsiArray = { {
+            SSI0_IRQn,
+            SSI1_IRQn,
+            SSI2_IRQn,
+            SSI3_IRQn,
+        } };
+
+        // RX only responds to burst requests, which the SSI raises with four or more
+        // entries in the FIFO. With an arbitration size of one item the DMA takes a
+        // single frame per request, so up to three frames always remain in the FIFO
+        // and the receive time-out reliably fires at the end of every transaction.
+        constexpr DmaChannel::Attributes txAttributes{ false, false, false, false };
+        constexpr DmaChannel::Attributes rxAttributes{ true, false, true, false };
+        constexpr DmaChannel::ControlBlock controlBlockTx{ DmaChannel::Increment::_8_bits, DmaChannel::Increment::none, DmaChannel::DataSize::_8_bits, DmaChannel::ArbitrationSize::_4_items };
+        constexpr DmaChannel::ControlBlock controlBlockRx{ DmaChannel::Increment::none, DmaChannel::Increment::_8_bits, DmaChannel::DataSize::_8_bits, DmaChannel::ArbitrationSize::_1_item };
+        constexpr DmaChannel::ControlBlock controlBlockRxDummy{ DmaChannel::Increment::none, DmaChannel::Increment::none, DmaChannel::DataSize::_8_bits, DmaChannel::ArbitrationSize::_1_item };
+
+        // In slave mode the programmed bit clock only times the receive time-out
+        SsiClockRate IdleTimeoutClockRate(std::chrono::microseconds idleTimeout)
+        {
+            really_assert(idleTimeout.count() > 0);
+
+            auto baudRate = static_cast<uint32_t>(std::max<uint64_t>(static_cast<uint64_t>(receiveTimeOutBits) * 1000000 / idleTimeout.count(), 1));
+            auto clockRate = CalculateSsiClockRate(SystemCoreClock, baudRate);
+            really_assert(clockRate.baudRate <= baudRate);
+
+            return clockRate;
+        }
+    }
+
+    SpiSlaveWithDma::SpiSlaveWithDma(uint8_t aSpiIndex, GpioPin& clock, GpioPin& miso, GpioPin& mosi, GpioPin& slaveSelect, Dma& dma, const Config& config)
+        : ssiIndex(aSpiIndex)
+        , clock(clock, PinConfigPeripheral::spiClock)
+        , miso(miso, PinConfigPeripheral::spiMiso)
+        , mosi(mosi, PinConfigPeripheral::spiMosi)
+        , slaveSelect(slaveSelect, PinConfigPeripheral::spiSlaveSelect)
+        , ssi(*reinterpret_cast<SSI0_Type*>(peripheralSsiArray[aSpiIndex]))
+        , format{ config.polarityLow, config.phase1st, 8, IdleTimeoutClockRate(config.idleTimeout) }
+        , dmaTx{ dma, ssiDmaChannels[aSpiIndex].tx, DmaChannel::Configuration{ txAttributes, controlBlockTx } }
+        , dmaRx{ dma, ssiDmaChannels[aSpiIndex].rx, DmaChannel::Configuration{ rxAttributes, controlBlockRx } }
+        , interruptRegistration(peripheralIrqSsiArray[aSpiIndex], [this]()
+              {
+                  HandleInterrupt();
+              })
+    {
+        EnableClock();
+        Initialize();
+    }
+
+    SpiSlaveWithDma::~SpiSlaveWithDma()
+    {
+        StopTransaction();
+        ssi.DMACTL = 0;
+        ssi.CR1 &= ~SSI_CR1_SSE;
+        DisableClock();
+    }
+
+    void SpiSlaveWithDma::SendAndReceive(infra::ConstByteRange sendData, infra::ByteRange receiveData, const infra::Function<void()>& onDone)
+    {
+        really_assert(!this->onDone);
+        really_assert(sendData.size() <= dmaTx.MaxTransferSize() && receiveData.size() <= dmaRx.MaxTransferSize());
+
+        this->onDone = onDone;
+        this->receiveData = receiveData;
+        bytesReceived = 0;
+
+        // Frames clocked in after the previous transaction ended
+        while ((ssi.SR & SSI_SR_RNE) != 0)
+            (void)ssi.DR;
+
+        volatile void* destination = &dummyRx;
+        rxTransferSize = dmaRx.MaxTransferSize();
+        if (!receiveData.empty())
+        {
+            destination = receiveData.begin();
+            rxTransferSize = receiveData.size();
+        }
+
+        dmaRx.SetControlBlock(receiveData.empty() ? controlBlockRxDummy : controlBlockRx);
+        dmaRx.StartTransfer(DmaChannel::Transfer::basic, DmaChannel::Buffers{ &ssi.DR, destination, rxTransferSize });
+
+        if (!sendData.empty())
+            dmaTx.StartTransfer(DmaChannel::Transfer::basic, DmaChannel::Buffers{ const_cast<uint8_t*>(sendData.begin()), &ssi.DR, sendData.size() });
+
+        ssi.ICR = SSI_ICR_RTIC | SSI_ICR_RORIC;
+#if defined(TM4C129)
+        ssi.IM |= SSI_IM_RTIM | SSI_IM_DMARXIM;
+#else
+        ssi.IM |= SSI_IM_RTIM;
+#endif
+    }
+
+    bool SpiSlaveWithDma::CancelTransmission()
+    {
+        if (!onDone)
+            return false;
+
+        StopTransaction();
+        ResetPeripheral();
+        rxTransferSize = 0;
+        onDone = nullptr;
+        return true;
+    }
+
+    std::size_t SpiSlaveWithDma::BytesReceived() const
+    {
+        return bytesReceived;
+    }
+
+    void SpiSlaveWithDma::Initialize()
+    {
+        ssi.CR1 &= ~SSI_CR1_SSE;
+        ssi.CC = SSI_CC_CS_SYSPLL;
+        ssi.CR1 |= SSI_CR1_MS;
+        ConfigureSsi(ssi, format);
+        ssi.DMACTL = SSI_DMACTL_TXDMAE | SSI_DMACTL_RXDMAE;
+        ssi.CR1 |= SSI_CR1_SSE;
+    }
+
+    void SpiSlaveWithDma::HandleInterrupt()
+    {
+        auto status = ssi.MIS;
+
+#if defined(TM4C129)
+        ssi.ICR = SSI_ICR_DMATXIC | SSI_ICR_DMARXIC;
+#endif
+        interruptRegistration.ClearPending();
+
+        if (rxTransferSize == 0)
+            return;
+
+        // The receive DMA signals completion on the SSI interrupt once receiveData is full
+        if ((status & SSI_MIS_RTMIS) != 0 || dmaRx.IsPrimaryTransferCompleted())
+        {
+            ssi.ICR = SSI_ICR_RTIC | SSI_ICR_RORIC;
+            EndTransaction();
+        }
+    }
+
+    void SpiSlaveWithDma::EndTransaction()
+    {
+        StopTransaction();
+
+        std::size_t transferred = rxTransferSize;
+        if (!dmaRx.IsPrimaryTransferCompleted())
+            transferred -= dmaRx.RemainingTransfers(false);
+
+        // Frames beyond the end of receiveData are dropped
+        while ((ssi.SR & SSI_SR_RNE) != 0)
+        {
+            uint8_t data = static_cast<uint8_t>(ssi.DR);
+
+            if (transferred < receiveData.size())
+                receiveData[transferred] = data;
+
+            ++transferred;
+        }
+
+        bytesReceived = std::min(transferred, receiveData.size());
+        rxTransferSize = 0;
+
+        // Preloaded data the master did not clock out would otherwise start the next transaction
+        if ((ssi.SR & SSI_SR_TFE) == 0)
+            ResetPeripheral();
+
+        infra::EventDispatcher::Instance().Schedule([this]()
+            {
+                onDone();
+            });
+    }
+
+    void SpiSlaveWithDma::StopTransaction()
+    {
+        ssi.IM &= ~(SSI_IM_RTIM | SSI_IM_DMARXIM);
+        dmaRx.StopTransfer();
+        dmaTx.StopTransfer();
+    }
+
+    void SpiSlaveWithDma::ResetPeripheral()
+    {
+        infra::ReplaceBit(SYSCTL->SRSSI, true, ssiIndex);
+        infra::ReplaceBit(SYSCTL->SRSSI, false, ssiIndex);
+
+        while (!infra::IsBitSet(SYSCTL->PRSSI, ssiIndex))
+        {
+        }
+
+        Initialize();
+    }
+
+    void SpiSlaveWithDma::EnableClock()
+    {
+        infra::ReplaceBit(SYSCTL->RCGCSSI, true, ssiIndex);
+
+        while (!infra::IsBitSet(SYSCTL->PRSSI, ssiIndex))
+        {
+        }
+    }
+
+    void SpiSlaveWithDma::DisableClock()
+    {
+        infra::ReplaceBit(SYSCTL->RCGCSSI, false, ssiIndex);
+    }
+}
@@ -0,0 +1,73 @@
+#ifndef HAL_SPI_SLAVE_WITH_DMA_TIVA_HPP
+#define HAL_SPI_SLAVE_WITH_DMA_TIVA_HPP
+
+#include "hal/interfaces/Spi.hpp"
+#include "hal_tiva/cortex/InterruptCortex.hpp"
+#include "hal_tiva/tiva/Dma.hpp"
+#include "hal_tiva/tiva/Gpio.hpp"
+#include "hal_tiva/tiva/Ssi.hpp"
+#include "infra/util/AutoResetFunction.hpp"
+#include <chrono>
+
+namespace hal::tiva
+{
+    // SSI in slave mode, the bus clock must not exceed a twelfth of the system clock.
+    // Received data is written in place by the DMA. A transaction ends when the master
+    // pauses the clock for longer than Config::idleTimeout, or when receiveData is full;
+    // frames the master sends after that are discarded. BytesReceived() tells how much
+    // of receiveData was filled.
+    class SpiSlaveWithDma
+        : public hal::SpiSlave
+    {
+    public:
+        struct Config
+        {
+            constexpr Config()
+            {}
+
+            bool polarityLow = true;
+            bool phase1st = true;
+            // Longer than any gap between frames of one transaction. The SSI times out after
+            // 32 periods of its own bit clock, which is derived from this.
+            std::chrono::microseconds idleTimeout = std::chrono::microseconds(100);
+        };
+
+        SpiSlaveWithDma(uint8_t aSpiIndex, GpioPin& clock, GpioPin& miso, GpioPin& mosi, GpioPin& slaveSelect, Dma& dma, const Config& config = Config());
+        ~SpiSlaveWithDma();
+
+        // Implementation of hal::SpiSlave
+        void SendAndReceive(infra::ConstByteRange sendData, infra::ByteRange receiveData, const infra::Function<void()>& onDone) override;
+        bool CancelTransmission() override;
+
+        std::size_t BytesReceived() const;
+
+    private:
+        void Initialize();
+        void HandleInterrupt();
+        void EndTransaction();
+        void StopTransaction();
+        void ResetPeripheral();
+        void EnableClock();
+        void DisableClock();
+
+    private:
+        uint8_t ssiIndex;
+        PeripheralPin clock;
+        PeripheralPin miso;
+        PeripheralPin mosi;
+        PeripheralPin slaveSelect;
+        SSI0_Type& ssi;
+        SsiFormat format;
+        DmaChannel dmaTx;
+        DmaChannel dmaRx;
+        ImmediateInterruptHandler interruptRegistration;
+
+        infra::AutoResetFunction<void()> onDone;
+        infra::ByteRange receiveData;
+        std::size_t rxTransferSize = 0;
+        std::size_t bytesReceived = 0;
+        uint8_t dummyRx = 0;
+    };
+}
+
+#endif
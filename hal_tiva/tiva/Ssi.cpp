@@ -0,0 +1,42 @@
+#include "hal_tiva/tiva/Ssi.hpp"
+#include "infra/util/ReallyAssert.hpp"
+
+namespace hal::tiva
+{
+    namespace
+    {
+        constexpr const uint32_t SSI_CR0_SCR_S = 8;
+        constexpr const uint32_t SSI_CR0_SPH = 0x00000080;      // SSI Serial Clock Phase
+        constexpr const uint32_t SSI_CR0_SPO = 0x00000040;      // SSI Serial Clock Polarity
+        constexpr const uint32_t SSI_CR0_FRF_MOTO = 0x00000000; // Freescale SPI Frame Format
+
+        constexpr const uint32_t SSI_CR1_SSE = 0x00000002; // SSI Synchronous Serial Port Enable
+
+        constexpr const uint32_t SSI_SR_BSY = 0x00000010; // SSI Busy Bit
+    }
+
+    void ConfigureSsi(SSI0_Type& ssi, const SsiFormat& format)
+    {
+        really_assert(format.dataSize >= 4 && format.dataSize <= 16);
+        really_assert(format.clockRate.prescaler >= 2 && format.clockRate.prescaler <= 254 && format.clockRate.prescaler % 2 == 0);
+        really_assert(format.clockRate.serialClockRate <= 255);
+
+        uint32_t cr0 = (format.clockRate.serialClockRate << SSI_CR0_SCR_S) | SSI_CR0_FRF_MOTO | (format.dataSize - 1u);
+
+        if (!format.phase1st)
+            cr0 |= SSI_CR0_SPH;
+
+        if (!format.polarityLow)
+            cr0 |= SSI_CR0_SPO;
+
+        while ((ssi.SR & SSI_SR_BSY) != 0)
+        {
+        }
+
+        auto enabled = ssi.CR1 & SSI_CR1_SSE;
+        ssi.CR1 &= ~SSI_CR1_SSE;
+        ssi.CR0 = cr0;
+        ssi.CPSR = format.clockRate.prescaler;
+        ssi.CR1 |= enabled;
+    }
+}
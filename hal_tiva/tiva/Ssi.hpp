@@ -0,0 +1,57 @@
+#ifndef HAL_SSI_TIVA_HPP
+#define HAL_SSI_TIVA_HPP
+
+#include DEVICE_HEADER
+#include <cstdint>
+
+namespace hal::tiva
+{
+    // SCK = ssiClock / (prescaler * (1 + serialClockRate))
+    struct SsiClockRate
+    {
+        uint32_t prescaler = 254;
+        uint32_t serialClockRate = 255;
+        uint32_t baudRate = 0;
+    };
+
+    // Closest achievable SCK that does not exceed maxBaudRate. When even the
+    // largest divisor is too fast, the slowest possible clock is returned.
+    constexpr SsiClockRate CalculateSsiClockRate(uint32_t ssiClock, uint32_t maxBaudRate)
+    {
+        constexpr uint32_t maxPrescaler = 254;
+        constexpr uint32_t maxSerialClockRate = 255;
+
+        uint32_t requiredDivisor = ssiClock / maxBaudRate + (ssiClock % maxBaudRate != 0 ? 1 : 0);
+        uint32_t bestDivisor = maxPrescaler * (maxSerialClockRate + 1);
+        SsiClockRate best{ maxPrescaler, maxSerialClockRate, ssiClock / bestDivisor };
+
+        for (uint32_t prescaler = 2; prescaler <= maxPrescaler && bestDivisor != requiredDivisor; prescaler += 2)
+        {
+            uint32_t scale = requiredDivisor / prescaler + (requiredDivisor % prescaler != 0 ? 1 : 0);
+            if (scale == 0)
+                scale = 1;
+
+            if (scale <= maxSerialClockRate + 1 && prescaler * scale < bestDivisor)
+            {
+                bestDivisor = prescaler * scale;
+                best = SsiClockRate{ prescaler, scale - 1, ssiClock / bestDivisor };
+            }
+        }
+
+        return best;
+    }
+
+    struct SsiFormat
+    {
+        bool polarityLow = true;
+        bool phase1st = true;
+        uint8_t dataSize = 8;
+        SsiClockRate clockRate;
+    };
+
+    // Programs frame format and bit rate of an SSI in Freescale SPI mode,
+    // the port is briefly disabled while the registers are written.
+    void ConfigureSsi(SSI0_Type& ssi, const SsiFormat& format);
+}
+
+#endif
@@ -0,0 +1,68 @@
+#include "hal_tiva/tiva/ThreePhasePwm.hpp"
+#include <algorithm>
+
+namespace hal::tiva
+{
+    namespace
+    {
+        constexpr const int32_t fullDutyCycle = 0x8000;
+        constexpr const int32_t halfDutyCycle = 0x4000;
+        constexpr const int32_t sqrt3By2 = 28378;   // Q15
+        constexpr const int32_t oneBySqrt3 = 18919; // Q15
+    }
+
+    ThreePhasePwm::ThreePhasePwm(Pwm& pwm, const Config& config)
+        : pwm(pwm)
+        , compensation((config.deadTimeCompensation + 1) / 2)
+    {}
+
+    void ThreePhasePwm::SetVoltage(int16_t alpha, int16_t beta, const Currents& currents)
+    {
+        SetDutyCycles(SpaceVector(alpha, beta), currents);
+    }
+
+    void ThreePhasePwm::SetDutyCycles(const DutyCycles& dutyCycles, const Currents& currents)
+    {
+        std::array<uint16_t, 3> compareValues = { {
+            CompareValue(dutyCycles[0], currents[0]),
+            CompareValue(dutyCycles[1], currents[1]),
+            CompareValue(dutyCycles[2], currents[2]),
+        } };
+
+        pwm.SetCompareValues(infra::MakeRange(compareValues));
+        pwm.Commit();
+    }
+
+    ThreePhasePwm::DutyCycles ThreePhasePwm::SpaceVector(int16_t alpha, int16_t beta)
+    {
+        int32_t halfAlpha = alpha / 2;
+        int32_t scaledBeta = (beta * sqrt3By2) >> 15;
+
+        std::array<int32_t, 3> voltages = { { alpha, scaledBeta - halfAlpha, -scaledBeta - halfAlpha } };
+        auto [min, max] = std::minmax({ voltages[0], voltages[1], voltages[2] });
+        auto zeroSequence = (min + max) / 2;
+
+        DutyCycles dutyCycles;
+        for (std::size_t phase = 0; phase != voltages.size(); ++phase)
+            dutyCycles[phase] = static_cast<uint16_t>(std::clamp<int32_t>(halfDutyCycle + (((voltages[phase] - zeroSequence) * oneBySqrt3) >> 15), 0, fullDutyCycle));
+
+        return dutyCycles;
+    }
+
+    uint16_t ThreePhasePwm::CompareValue(uint16_t dutyCycle, int16_t current) const
+    {
+        // In center-aligned mode the counter covers the period twice, so the high time
+        // is twice the width between the compare value and the load
+        int32_t load = pwm.Load();
+        int32_t width = (load * dutyCycle) >> 15;
+
+        // The dead band delays the switch that takes over the current, which shortens
+        // the applied voltage when the current flows out of the phase and lengthens it otherwise
+        if (current > 0)
+            width += compensation;
+        else if (current < 0)
+            width -= compensation;
+
+        return static_cast<uint16_t>(load - std::clamp<int32_t>(width, 0, load));
+    }
+}
@@ -0,0 +1,51 @@
+#ifndef HAL_THREE_PHASE_PWM_TIVA_HPP
+#define HAL_THREE_PHASE_PWM_TIVA_HPP
+
+#include "hal_tiva/tiva/Pwm.hpp"
+#include <array>
+#include <cstdint>
+
+namespace hal::tiva
+{
+    // Drives a three-phase inverter from a Pwm with exactly three generators, one per
+    // phase, configured center-aligned with a dead band and global updates. Channel A of
+    // each generator drives the high side and its dead band complement the low side.
+    //
+    // New duty cycles are committed together and applied at the next zero count, when
+    // all low sides conduct. Triggering the ADC on Trigger::countZero of one generator
+    // therefore samples low-side shunt currents in the middle of the off time, in the
+    // same period in which the previous update took effect.
+    class ThreePhasePwm
+    {
+    public:
+        static constexpr Pwm::PinChannel::Trigger currentSamplingTrigger = Pwm::PinChannel::Trigger::countZero;
+
+        using DutyCycles = std::array<uint16_t, 3>; // Q15, 0x8000 is 100%
+        using Currents = std::array<int16_t, 3>;    // Only the sign is used
+
+        struct Config
+        {
+            uint16_t deadTimeCompensation = 0; // PWM clock cycles lost to the dead band every period
+        };
+
+        ThreePhasePwm(Pwm& pwm, const Config& config);
+
+        // alpha and beta are in Q15 of the largest voltage in the linear range, Vdc / sqrt(3).
+        // Longer vectors are clipped per phase.
+        void SetVoltage(int16_t alpha, int16_t beta, const Currents& currents = {});
+        void SetDutyCycles(const DutyCycles& dutyCycles, const Currents& currents = {});
+
+        // Space-vector modulation by min-max zero sequence injection, which gives the
+        // same timings as the sector based method with both zero vectors equally long
+        static DutyCycles SpaceVector(int16_t alpha, int16_t beta);
+
+    private:
+        uint16_t CompareValue(uint16_t dutyCycle, int16_t current) const;
+
+    private:
+        Pwm& pwm;
+        uint16_t compensation;
+    };
+}
+
+#endif
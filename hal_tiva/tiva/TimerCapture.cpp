@@ -0,0 +1,381 @@
+#include "hal_tiva/tiva/TimerCapture.hpp"
+#include "infra/event/EventDispatcher.hpp"
+#include "infra/util/EnumCast.hpp"
+#include "infra/util/ReallyAssert.hpp"
+
+extern "C" uint32_t SystemCoreClock;
+
+namespace
+{
+    extern "C" void Timer0A_Handler()
+    {
+        hal::InterruptTable::Instance().Invoke(TIMER0A_IRQn);
+    }
+
+    extern "C" void Timer0B_Handler()
+    {
+        hal::InterruptTable::Instance().Invoke(TIMER0B_IRQn);
+    }
+
+    extern "C" void Timer1A_Handler()
+    {
+        hal::InterruptTable::Instance().Invoke(TIMER1A_IRQn);
+    }
+
+    extern "C" void Timer1B_Handler()
+    {
+        hal::InterruptTable::Instance().Invoke(TIMER1B_IRQn);
+    }
+
+    extern "C" void Timer2A_Handler()
+    {
+        hal::InterruptTable::Instance().Invoke(TIMER2A_IRQn);
+    }
+
+    extern "C" void Timer2B_Handler()
+    {
+        hal::InterruptTable::Instance().Invoke(TIMER2B_IRQn);
+    }
+
+    extern "C" void Timer3A_Handler()
+    {
+        hal::InterruptTable::Instance().Invoke(TIMER3A_IRQn);
+    }
+
+    extern "C" void Timer3B_Handler()
+    {
+        hal::InterruptTable::Instance().Invoke(TIMER3B_IRQn);
+    }
+
+    extern "C" void Timer4A_Handler()
+    {
+        hal::InterruptTable::Instance().Invoke(TIMER4A_IRQn);
+    }
+
+    extern "C" void Timer4B_Handler()
+    {
+        hal::InterruptTable::Instance().Invoke(TIMER4B_IRQn);
+    }
+
+    extern "C" void Timer5A_Handler()
+    {
+        hal::InterruptTable::Instance().Invoke(TIMER5A_IRQn);
+    }
+
+    extern "C" void Timer5B_Handler()
+    {
+        hal::InterruptTable::Instance().Invoke(TIMER5B_IRQn);
+    }
+}
+
+namespace hal::tiva
+{
+    namespace
+    {
+        constexpr const uint32_t TIMER_CFG_16_BIT = 0x00000004;
+        constexpr const uint32_t TIMER_TAMR_TAMR_CAP = 0x00000003;
+        constexpr const uint32_t TIMER_TAMR_TACMR = 0x00000004;
+        constexpr const uint32_t TIMER_CTL_TAEN = 0x00000001;
+        constexpr const uint32_t TIMER_CTL_TBEN = 0x00000100;
+        constexpr const uint32_t TIMER_CTL_TAEVENT_M = 0x0000000C;
+        constexpr const uint32_t TIMER_CTL_TAEVENT_S = 2;
+        constexpr const uint32_t TIMER_IMR_CAMIM = 0x00000002;
+        constexpr const uint32_t TIMER_IMR_CAEIM = 0x00000004;
+        constexpr const uint32_t TIMER_MIS_CAMMIS = 0x00000002;
+        constexpr const uint32_t TIMER_MIS_CAEMIS = 0x00000004;
+        constexpr const uint32_t TIMER_ICR_CAMCINT = 0x00000002;
+        constexpr const uint32_t TIMER_ICR_CAECINT = 0x00000004;
+
+        // Channel B uses the channel A bit positions, shifted by a byte
+        constexpr const uint32_t channelBShift = 8;
+
+        // The 16-bit interval load extended by the 8-bit prescaler
+        constexpr const uint32_t intervalLoad = 0xffff;
+        constexpr const uint32_t prescaleLoad = 0xff;
+        constexpr const uint32_t counterMask = 0x00ffffff;
+
+        constexpr std::array<uint32_t, 6> peripheralTimerArray = { {
+            TIMER0_BASE,
+            TIMER1_BASE,
+            TIMER2_BASE,
+            TIMER3_BASE,
+            TIMER4_BASE,
+            TIMER5_BASE,
+        } };
+
+        constexpr std::array<IRQn_Type, 12> peripheralIrqTimerArray = { {
+            TIMER0A_IRQn,
+            TIMER0B_IRQn,
+            TIMER1A_IRQn,
+            TIMER1B_IRQn,
+            TIMER2A_IRQn,
+            TIMER2B_IRQn,
+            TIMER3A_IRQn,
+            TIMER3B_IRQn,
+            TIMER4A_IRQn,
+            TIMER4B_IRQn,
+            TIMER5A_IRQn,
+            TIMER5B_IRQn,
+        } };
+    }
+
+    uint32_t TimerCapture::Batch::Period() const
+    {
+        // With both edges captured, a period consists of two consecutive intervals
+        std::size_t intervalsPerPeriod = edge == Edge::both ? 2 : 1;
+        std::size_t periods = intervals.size() / intervalsPerPeriod;
+
+        if (periods == 0)
+            return 0;
+
+        uint64_t sum = 0;
+        for (std::size_t i = 0; i != periods * intervalsPerPeriod; ++i)
+            sum += intervals[i];
+
+        return static_cast<uint32_t>(sum / periods);
+    }
+
+    std::optional<uint32_t> TimerCapture::Batch::HighTime() const
+    {
+        if (edge != Edge::both || intervals.size() < 2)
+            return std::nullopt;
+
+        uint64_t sum = 0;
+        uint32_t count = 0;
+        for (std::size_t i = firstIntervalHigh ? 0 : 1; i < intervals.size(); i += 2)
+        {
+            sum += intervals[i];
+            ++count;
+        }
+
+        return static_cast<uint32_t>(sum / count);
+    }
+
+    TimerCapture::TimerCapture(uint8_t timerIndex, GpioPin& pin, const Config& config)
+        : timerIndex(timerIndex)
+        , config(config)
+        , pin(pin)
+        , capturePin(pin, config.channel == Channel::a ? PinConfigPeripheral::timerCapture0 : PinConfigPeripheral::timerCapture1)
+        , shift(config.channel == Channel::a ? 0 : channelBShift)
+        , interruptRegistration(peripheralIrqTimerArray.at(2 * timerIndex + infra::enum_cast(config.channel)), config.priority, [this]()
+              {
+                  HandleInterrupt();
+              })
+    {
+        really_assert(config.batchSize > 0 && config.batchSize <= maxBatchSize);
+
+        EnableClock();
+        Configure();
+    }
+
+    TimerCapture::~TimerCapture()
+    {
+        Stop();
+
+        // The other half of the timer may still be in use
+        if ((Timer().CTL & (TIMER_CTL_TAEN | TIMER_CTL_TBEN)) == 0)
+            SYSCTL->RCGCTIMER &= ~(1 << timerIndex);
+    }
+
+    void TimerCapture::Measure(const infra::Function<void(const Batch& batch)>& onBatch)
+    {
+        really_assert(config.mode == Mode::edgeTime);
+
+        this->onBatch = onBatch;
+        buffers[0].clear();
+        buffers[1].clear();
+        filling = 0;
+        dropped = 0;
+        previousCapture = std::nullopt;
+        running = true;
+
+        auto& timer = Timer();
+        timer.ICR = TIMER_ICR_CAECINT << shift;
+        timer.IMR |= TIMER_IMR_CAEIM << shift;
+        Enable();
+    }
+
+    void TimerCapture::StartCounting()
+    {
+        really_assert(config.mode == Mode::edgeCount);
+
+        running = true;
+
+        auto& timer = Timer();
+        timer.ICR = TIMER_ICR_CAMCINT << shift;
+        timer.IMR |= TIMER_IMR_CAMIM << shift;
+        Enable();
+
+        ResetCount();
+    }
+
+    void TimerCapture::Stop()
+    {
+        running = false;
+        Disable();
+
+        auto& timer = Timer();
+        timer.IMR &= ~((TIMER_IMR_CAMIM | TIMER_IMR_CAEIM) << shift);
+        timer.ICR = (TIMER_ICR_CAMCINT | TIMER_ICR_CAECINT) << shift;
+    }
+
+    uint32_t TimerCapture::EdgeCount() const
+    {
+        return RawCount() - countOffset;
+    }
+
+    void TimerCapture::ResetCount()
+    {
+        countOffset = RawCount();
+    }
+
+    uint32_t TimerCapture::ClockFrequency()
+    {
+        return SystemCoreClock;
+    }
+
+    TIMER0_Type& TimerCapture::Timer() const
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) - hardware register access
+        return *reinterpret_cast<TIMER0_Type*>(peripheralTimerArray.at(timerIndex));
+    }
+
+    volatile uint32_t& TimerCapture::Register(volatile uint32_t& channelARegister) const
+    {
+        // The channel B registers directly follow their channel A counterparts
+        return (&channelARegister)[config.channel == Channel::a ? 0 : 1];
+    }
+
+    void TimerCapture::EnableClock() const
+    {
+        SYSCTL->RCGCTIMER |= 1 << timerIndex;
+
+        while ((SYSCTL->PRTIMER & (1 << timerIndex)) == 0)
+        {
+        }
+    }
+
+    void TimerCapture::Configure()
+    {
+        auto& timer = Timer();
+
+        Disable();
+        timer.CFG = TIMER_CFG_16_BIT;
+        Register(timer.TAMR) = TIMER_TAMR_TAMR_CAP | (config.mode == Mode::edgeTime ? TIMER_TAMR_TACMR : 0);
+        timer.CTL = (timer.CTL & ~(TIMER_CTL_TAEVENT_M << shift)) | (infra::enum_cast(config.edge) << TIMER_CTL_TAEVENT_S << shift);
+        Register(timer.TAILR) = intervalLoad;
+        Register(timer.TAPR) = prescaleLoad;
+
+        // Counting down to zero, the match interrupt marks a wrap of the edge counter
+        if (config.mode == Mode::edgeCount)
+        {
+            Register(timer.TAMATCHR) = 0;
+            Register(timer.TAPMR) = 0;
+        }
+    }
+
+    void TimerCapture::Enable()
+    {
+        Timer().CTL |= TIMER_CTL_TAEN << shift;
+    }
+
+    void TimerCapture::Disable()
+    {
+        Timer().CTL &= ~(TIMER_CTL_TAEN << shift);
+    }
+
+    uint32_t TimerCapture::RawCount() const
+    {
+        uint32_t wrapped;
+        uint32_t value;
+
+        do
+        {
+            wrapped = wraps;
+            value = Register(Timer().TAR) & counterMask;
+        } while (wrapped != wraps);
+
+        // Counting down from counterMask to the match at zero takes counterMask edges
+        return wrapped * counterMask + (counterMask - value);
+    }
+
+    void TimerCapture::HandleInterrupt()
+    {
+        auto& timer = Timer();
+        auto status = timer.MIS >> shift;
+
+        if ((status & TIMER_MIS_CAEMIS) != 0)
+        {
+            timer.ICR = TIMER_ICR_CAECINT << shift;
+            HandleCapture(Register(timer.TAR) & counterMask);
+        }
+
+        if ((status & TIMER_MIS_CAMMIS) != 0)
+        {
+            // On a match the hardware reloads the counter and disables the timer; edges
+            // arriving before it is enabled again are not counted
+            timer.ICR = TIMER_ICR_CAMCINT << shift;
+            ++wraps;
+            Enable();
+        }
+    }
+
+    void TimerCapture::HandleCapture(uint32_t capture)
+    {
+        if (!previousCapture)
+        {
+            previousCapture = capture;
+            return;
+        }
+
+        // The counter counts down, modulo 2^24
+        auto interval = (*previousCapture - capture) & counterMask;
+        previousCapture = capture;
+
+        auto& buffer = buffers[filling];
+
+        if (buffer.size() == config.batchSize)
+        {
+            if (delivering)
+            {
+                ++dropped;
+                return;
+            }
+
+            SwapBuffers();
+        }
+
+        // The interval that ends with this edge was high when the input is now low
+        if (buffers[filling].empty())
+            firstIntervalHigh[filling] = !pin.Get();
+
+        buffers[filling].push_back(interval);
+
+        if (buffers[filling].size() == config.batchSize && !delivering)
+            SwapBuffers();
+    }
+
+    void TimerCapture::SwapBuffers()
+    {
+        droppedEdges[filling] = dropped;
+        dropped = 0;
+        filling ^= 1;
+        buffers[filling].clear();
+        delivering = true;
+
+        infra::EventDispatcher::Instance().Schedule([this]()
+            {
+                Deliver();
+            });
+    }
+
+    void TimerCapture::Deliver()
+    {
+        const auto& buffer = buffers[filling ^ 1];
+
+        if (running && onBatch)
+            onBatch(Batch{ infra::MemoryRange<const uint32_t>(buffer.begin(), buffer.end()), config.edge, firstIntervalHigh[filling ^ 1], droppedEdges[filling ^ 1] });
+
+        delivering = false;
+    }
+}
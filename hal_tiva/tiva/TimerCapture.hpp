@@ -0,0 +1,120 @@
+#ifndef HAL_TIMER_CAPTURE_TIVA_HPP
+#define HAL_TIMER_CAPTURE_TIVA_HPP
+
+#include "hal_tiva/cortex/InterruptCortex.hpp"
+#include "hal_tiva/tiva/Gpio.hpp"
+#include "infra/util/BoundedVector.hpp"
+#include "infra/util/Function.hpp"
+#include "infra/util/MemoryRange.hpp"
+#include <array>
+#include <cstdint>
+#include <optional>
+#include DEVICE_HEADER
+
+namespace hal::tiva
+{
+    // Input capture on one half of a 16/32-bit GPTM, with the prescaler extending the
+    // counter to 24 bits. In edge-time mode every edge is timestamped in interrupt
+    // context and the intervals are delivered in batches through the event dispatcher,
+    // so an event is scheduled per batch instead of per edge. Intervals longer than
+    // 2^24 timer clocks wrap. In edge-count mode the hardware counts the edges and the
+    // CPU is only involved once every 2^24 - 1 edges. The hardware stops the counter at
+    // that point until the interrupt re-enables it, so edges arriving within the
+    // interrupt latency are missed.
+    class TimerCapture
+    {
+    public:
+        static constexpr std::size_t maxBatchSize = 32;
+
+        enum class Channel : uint8_t
+        {
+            a,
+            b,
+        };
+
+        enum class Mode : uint8_t
+        {
+            edgeTime,
+            edgeCount,
+        };
+
+        enum class Edge : uint8_t
+        {
+            rising = 0,
+            falling = 1,
+            both = 3,
+        };
+
+        struct Config
+        {
+            Channel channel = Channel::a;
+            Mode mode = Mode::edgeTime;
+            Edge edge = Edge::rising;
+            uint8_t batchSize = 16; // Intervals per delivered batch, at most maxBatchSize
+            InterruptPriority priority = InterruptPriority::Normal;
+        };
+
+        struct Batch
+        {
+            infra::MemoryRange<const uint32_t> intervals; // Timer clocks between consecutive captured edges
+            Edge edge;
+            bool firstIntervalHigh; // Only meaningful when both edges are captured
+            uint32_t droppedEdges;  // Since the previous batch, while both buffers were in use
+
+            // Averages over the batch, in timer clocks
+            uint32_t Period() const;
+            std::optional<uint32_t> HighTime() const;
+        };
+
+        TimerCapture(uint8_t timerIndex, GpioPin& pin, const Config& config);
+        TimerCapture(const TimerCapture& other) = delete;
+        TimerCapture& operator=(const TimerCapture& other) = delete;
+        ~TimerCapture();
+
+        void Measure(const infra::Function<void(const Batch& batch)>& onBatch);
+        void StartCounting();
+        void Stop();
+
+        uint32_t EdgeCount() const;
+        void ResetCount();
+
+        static uint32_t ClockFrequency();
+
+    private:
+        TIMER0_Type& Timer() const;
+        volatile uint32_t& Register(volatile uint32_t& channelARegister) const;
+        void EnableClock() const;
+        void Configure();
+        void Enable();
+        void Disable();
+        uint32_t RawCount() const;
+        void HandleInterrupt();
+        void HandleCapture(uint32_t capture);
+        void SwapBuffers();
+        void Deliver();
+
+    private:
+        uint8_t timerIndex;
+        Config config;
+        GpioPin& pin;
+        PeripheralPin capturePin;
+        uint32_t shift;
+
+        infra::Function<void(const Batch& batch)> onBatch;
+        std::array<infra::BoundedVector<uint32_t>::WithMaxSize<maxBatchSize>, 2> buffers;
+        std::array<bool, 2> firstIntervalHigh{};
+        std::array<uint32_t, 2> droppedEdges{};
+        uint8_t filling = 0;
+        volatile bool delivering = false;
+        bool running = false;
+        std::optional<uint32_t> previousCapture;
+        uint32_t dropped = 0;
+
+        volatile uint32_t wraps = 0;
+        uint32_t countOffset = 0;
+
+        ImmediateInterruptHandler interruptRegistration;
+    };
+}
+
+#endif
@@ -61,6 +61,10 @@ void Uart4_Handler() __attribute__((weak, alias("Default_Handler")));
 void Uart5_Handler() __attribute__((weak, alias("Default_Handler")));
 void Uart6_Handler() __attribute__((weak, alias("Default_Handler")));
 void Uart7_Handler() __attribute__((weak, alias("Default_Handler")));
+void Ssi0_Handler() __attribute__((weak, alias("Default_Handler")));
+void Ssi1_Handler() __attribute__((weak, alias("Default_Handler")));
+void Ssi2_Handler() __attribute__((weak, alias("Default_Handler")));
+void Ssi3_Handler() __attribute__((weak, alias("Default_Handler")));
 void Pwm0Generator0_Handler() __attribute__((weak, alias("Default_Handler")));
 void Pwm0Generator1_Handler() __attribute__((weak, alias("Default_Handler")));
 void Pwm0Generator2_Handler() __attribute__((weak, alias("Default_Handler")));
@@ -73,6 +77,18 @@ void Pwm1Generator3_Handler() __attribute__((weak, alias("Default_Handler")));
 void Pwm1Fault_Handler()      __attribute__((weak, alias("Default_Handler")));
 void Comp0_Handler()          __attribute__((weak, alias("Default_Handler")));
 void Comp1_Handler()          __attribute__((weak, alias("Default_Handler")));
+void Timer0A_Handler()        __attribute__((weak, alias("Default_Handler")));
+void Timer0B_Handler()        __attribute__((weak, alias("Default_Handler")));
+void Timer1A_Handler()        __attribute__((weak, alias("Default_Handler")));
+void Timer1B_Handler()        __attribute__((weak, alias("Default_Handler")));
+void Timer2A_Handler()        __attribute__((weak, alias("Default_Handler")));
+void Timer2B_Handler()        __attribute__((weak, alias("Default_Handler")));
+void Timer3A_Handler()        __attribute__((weak, alias("Default_Handler")));
+void Timer3B_Handler()        __attribute__((weak, alias("Default_Handler")));
+void Timer4A_Handler()        __attribute__((weak, alias("Default_Handler")));
+void Timer4B_Handler()        __attribute__((weak, alias("Default_Handler")));
+void Timer5A_Handler()        __attribute__((weak, alias("Default_Handler")));
+void Timer5B_Handler()        __attribute__((weak, alias("Default_Handler")));
 
 //*****************************************************************************
 //
@@ -132,7 +148,7 @@ __attribute__((section(".isr_vector"))) void (*const g_pfnVectors[])(void) = {
     Default_Handler,       /*!< GPIOE_Handler,             GPIO Port E */
     Uart0_Handler,         /*!< UART0_Handler,             UART0 Rx and Tx */
     Uart1_Handler,         /*!< UART1_Handler,             UART1 Rx and Tx */
-    Default_Handler,       /*!< SSI0_Handler,              SSI0 Rx and Tx */
+    Ssi0_Handler,          /*!< SSI0_Handler,              SSI0 Rx and Tx */
     Default_Handler,       /*!< I2C0_Handler,              I2C0 Master and Slave */
     Pwm0Fault_Handler,      /*!< PMW0_FAULT_Handler,        PWM Fault */
     Pwm0Generator0_Handler, /*!< PWM0_0_Handler,            PWM Generator 0 */
@@ -144,12 +160,12 @@ __attribute__((section(".isr_vector"))) void (*const g_pfnVectors[])(void) = {
     Adc0Sequence2_Handler, /*!< ADC0SS2_Handler,           ADC Sequence 2 */
     Adc0Sequence3_Handler, /*!< ADC0SS3_Handler,           ADC Sequence 3 */
     Default_Handler,       /*!< WDT_Handler,               Watchdog timer */
-    Default_Handler,       /*!< TIMER0A_Handler,           Timer 0 subtimer A */
-    Default_Handler,       /*!< TIMER0B_Handler,           Timer 0 subtimer B */
-    Default_Handler,       /*!< TIMER1A_Handler,           Timer 1 subtimer A */
-    Default_Handler,       /*!< TIMER1B_Handler,           Timer 1 subtimer B */
-    Default_Handler,       /*!< TIMER2A_Handler,           Timer 2 subtimer A */
-    Default_Handler,       /*!< TIMER2B_Handler,           Timer 2 subtimer B */
+    Timer0A_Handler,       /*!< TIMER0A_Handler,           Timer 0 subtimer A */
+    Timer0B_Handler,       /*!< TIMER0B_Handler,           Timer 0 subtimer B */
+    Timer1A_Handler,       /*!< TIMER1A_Handler,           Timer 1 subtimer A */
+    Timer1B_Handler,       /*!< TIMER1B_Handler,           Timer 1 subtimer B */
+    Timer2A_Handler,       /*!< TIMER2A_Handler,           Timer 2 subtimer A */
+    Timer2B_Handler,       /*!< TIMER2B_Handler,           Timer 2 subtimer B */
     Comp0_Handler,         /*!< COMP0_Handler,             Analog Comparator 0 */
     Comp1_Handler,         /*!< COMP1_Handler,             Analog Comparator 1 */
     0,                     /*!< Reserved */
@@ -159,9 +175,9 @@ __attribute__((section(".isr_vector"))) void (*const g_pfnVectors[])(void) = {
     0,                     /*!< Reserved */
     0,                     /*!< Reserved */
     Uart2_Handler,         /*!< UART2_Handler,             UART2 Rx and Tx */
-    Default_Handler,       /*!< SSI1_Handler,              SSI1 Rx and Tx */
-    Default_Handler,       /*!< TIMER3A_Handler,           Timer 3 subtimer A */
-    Default_Handler,       /*!< TIMER3B_Handler,           Timer 3 subtimer B */
+    Ssi1_Handler,          /*!< SSI1_Handler,              SSI1 Rx and Tx */
+    Timer3A_Handler,       /*!< TIMER3A_Handler,           Timer 3 subtimer A */
+    Timer3B_Handler,       /*!< TIMER3B_Handler,           Timer 3 subtimer B */
     Default_Handler,       /*!< I2C1_Handler,              I2C1 Master and Slave */
     Default_Handler,       /*!< QEI1_Handler,              Quadrature Encoder 1 */
     Can0_Handler,          /*!< CAN0_Handler,              CAN0 */
@@ -182,8 +198,8 @@ __attribute__((section(".isr_vector"))) void (*const g_pfnVectors[])(void) = {
     0,                     /*!< Reserved */
     0,                     /*!< Reserved */
     0,                     /*!< Reserved */
-    Default_Handler,       /*!< SSI2_Handler,              SSI2 Rx and Tx */
-    Default_Handler,       /*!< SSI3_Handler,              SSI3 Rx and Tx */
+    Ssi2_Handler,          /*!< SSI2_Handler,              SSI2 Rx and Tx */
+    Ssi3_Handler,          /*!< SSI3_Handler,              SSI3 Rx and Tx */
     Uart3_Handler,         /*!< UART3_Handler,             UART3 Rx and Tx */
     Uart4_Handler,         /*!< UART4_Handler,             UART4 Rx and Tx */
     Uart5_Handler,         /*!< UART5_Handler,             UART5 Rx and Tx */
@@ -195,8 +211,8 @@ __attribute__((section(".isr_vector"))) void (*const g_pfnVectors[])(void) = {
     0,                     /*!< Reserved */
     Default_Handler,       /*!< I2C2_Handler                I2C2 Master and Slave */
     Default_Handler,       /*!< I2C3_Handler,               I2C3 Master and Slave */
-    Default_Handler,       /*!< TIMER4A_Handler,            Timer 4 subtimer A */
-    Default_Handler,       /*!< TIMER4B_Handler,            Timer 4 subtimer B */
+    Timer4A_Handler,       /*!< TIMER4A_Handler,            Timer 4 subtimer A */
+    Timer4B_Handler,       /*!< TIMER4B_Handler,            Timer 4 subtimer B */
     0,                     /*!< Reserved */
     0,                     /*!< Reserved */
     0,                     /*!< Reserved */
@@ -217,8 +233,8 @@ __attribute__((section(".isr_vector"))) void (*const g_pfnVectors[])(void) = {
     0,                     /*!< Reserved */
     0,                     /*!< Reserved */
     0,                     /*!< Reserved */
-    Default_Handler,       /*!< TIMER5A_Handler,           Timer 5 subtimer A */
-    Default_Handler,       /*!< TIMER5B_Handler,           Timer 5 subtimer B */
+    Timer5A_Handler,       /*!< TIMER5A_Handler,           Timer 5 subtimer A */
+    Timer5B_Handler,       /*!< TIMER5B_Handler,           Timer 5 subtimer B */
     Default_Handler,       /*!< WTIMER0A_Handler,          Wide Timer 0 subtimer A */
     Default_Handler,       /*!< WTIMER0B_Handler,          Wide Timer 0 subtimer B */
     Default_Handler,       /*!< WTIMER1A_Handler,          Wide Timer 1 subtimer A */